@@ -76,6 +76,12 @@ namespace nodeeditor::common::view
         base::mvp::utility::Signal<const bool&> select_changed;
         /** @brief Set selection state and emit @ref select_changed. */
         void set_select(bool s);
+        /**
+         * @brief Set selection state without @ref select_changed or its callback.
+         *
+         * For owners that apply a batch of selection changes and report them once.
+         */
+        void set_select_silently(bool s);
 
         /** @brief Emitted when mouse pressed changes. */
         base::mvp::utility::Signal<const bool&> pressed_changed;
@@ -99,6 +105,13 @@ namespace nodeeditor::common::view
         bool sceneEvent(QEvent* event) override;
         QVariant itemChange(GraphicsItemChange change, const QVariant& value) override;
 
+        /**
+         * @brief Drop every slot and callback and clear the interaction flags.
+         *
+         * For views handed back to a ViewPool; the next owner connects again.
+         */
+        void resetViewConnections();
+
     protected:
         static QRectF toQRectF(const utility::SRect& r);
 
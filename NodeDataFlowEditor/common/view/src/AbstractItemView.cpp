@@ -139,6 +139,16 @@ namespace nodeeditor::common::view
         update();
     }
 
+    void AbstractItemView::set_select_silently(bool s)
+    {
+        if (select_ == s)
+            return;
+        // setSelected() comes back through itemChange() into set_select(), which sees no change.
+        select_ = s;
+        setSelected(s);
+        update();
+    }
+
     void AbstractItemView::set_hovered(bool s)
     {
         if (hovered_ == s)
@@ -273,6 +283,44 @@ namespace nodeeditor::common::view
         return QGraphicsItem::itemChange(change, value);
     }
 
+    void AbstractItemView::resetViewConnections()
+    {
+        rotation_changed.disconnectAll();
+        scale_changed.disconnectAll();
+        pos_changed.disconnectAll();
+        rect_changed.disconnectAll();
+        enable_changed.disconnectAll();
+        visible_changed.disconnectAll();
+        active_changed.disconnectAll();
+        select_changed.disconnectAll();
+        hovered_changed.disconnectAll();
+        pressed_changed.disconnectAll();
+        double_clicked_changed.disconnectAll();
+        moving_changed.disconnectAll();
+
+        onColorChanged = nullptr;
+        onRotationChanged = nullptr;
+        onScaleChanged = nullptr;
+        onPosChanged = nullptr;
+        onRectChanged = nullptr;
+        onEnableChanged = nullptr;
+        onVisibleChanged = nullptr;
+        onActiveChanged = nullptr;
+        onSelectChanged = nullptr;
+        onHoverChanged = nullptr;
+        onPressedChanged = nullptr;
+        onDoubleClickedChanged = nullptr;
+        onMovingChanged = nullptr;
+
+        setSelected(false);
+        active_ = false;
+        select_ = false;
+        hovered_ = false;
+        pressed_ = false;
+        double_clicked_ = false;
+        moving_ = false;
+    }
+
     // -------------------- Callbacks Setters --------------------
 
     void AbstractItemView::setOnColorChanged(std::function<void(const QColor&)> cb) { onColorChanged = std::move(cb); }
@@ -108,6 +108,16 @@ namespace nodeeditor::common::view
         update();
     }
 
+    void AbstractPathView::set_select_silently(bool s)
+    {
+        if (select_ == s)
+            return;
+        // setSelected() comes back through itemChange() into set_select(), which sees no change.
+        select_ = s;
+        setSelected(s);
+        update();
+    }
+
     void AbstractPathView::set_pressed(bool s)
     {
         if (pressed_ == s)
@@ -168,6 +178,25 @@ namespace nodeeditor::common::view
         return QGraphicsItem::itemChange(change, value);
     }
 
+    void AbstractPathView::resetViewConnections()
+    {
+        pos_changed.disconnectAll();
+        rect_changed.disconnectAll();
+        visible_changed.disconnectAll();
+        select_changed.disconnectAll();
+        pressed_changed.disconnectAll();
+
+        onPosChanged = nullptr;
+        onRectChanged = nullptr;
+        onVisibleChanged = nullptr;
+        onSelectChanged = nullptr;
+        onPressedChanged = nullptr;
+
+        setSelected(false);
+        select_ = false;
+        pressed_ = false;
+    }
+
     // -------------------- Callbacks Setters --------------------
 
     void AbstractPathView::setOnPosChanged(std::function<void(const utility::SPos&)> cb) { onPosChanged = std::move(cb); }
@@ -4,10 +4,7 @@
 #include "core/model/PortItemModel.hpp"
 #include "core/presenter/PortItemPresenter.hpp"
 #include "core/view/NodeItemView.hpp"
-#include <QCheckBox>
-#include <QDoubleSpinBox>
-#include <QLineEdit>
-#include <QSpinBox>
+#include "core/view/ParameterTypeRegistry.hpp"
 
 namespace nodeeditor::core::presenter
 {
@@ -26,14 +23,12 @@ namespace nodeeditor::core::presenter
         m->remove_input.connect([v](const std::string& n) { v->removeInput(QString::fromStdString(n)); });
         m->remove_output.connect([v](const std::string& n) { v->removeOutput(QString::fromStdString(n)); });
         m->add_parameter.connect([v](const std::string& type, const std::string& n, const std::string& d) {
-            if (type == "QString" || type == "string")
-                v->addParameter(new QLineEdit(), QString::fromStdString(n), QString::fromStdString(d));
-            else if (type == "bool")
-                v->addParameter(new QCheckBox(), QString::fromStdString(n), QString::fromStdString(d));
-            else if (type == "int")
-                v->addParameter(new QSpinBox(), QString::fromStdString(n), QString::fromStdString(d));
-            else if (type == "double" || type == "float")
-                v->addParameter(new QDoubleSpinBox(), QString::fromStdString(n), QString::fromStdString(d));
+            using Registry = view::ParameterTypeRegistry;
+            const auto id = Registry::typeId(type);
+            if (auto* control = Registry::createControl(id))
+                v->addParameter(control, QString::fromStdString(n), QString::fromStdString(d));
+            else if (auto* editor = Registry::createEditor(id))
+                v->addParameter(editor, QString::fromStdString(n), QString::fromStdString(d));
         });
         m->remove_parameter.connect([v](const std::string& n) { v->removeParamInput(QString::fromStdString(n)); });
 
@@ -41,7 +36,20 @@ namespace nodeeditor::core::presenter
         v->text_changed.connect([m](const std::string& t) { m->set_text(t); });
     }
 
-    NodeItemPresenter::~NodeItemPresenter() = default;
+    NodeItemPresenter::~NodeItemPresenter()
+    {
+        // The model can outlive this presenter (parked nodes); drop the slots bound to the view.
+        if (auto* m = dynamic_cast<model::NodeItemModel*>(m_model.get()))
+        {
+            m->text_changed.disconnectAll();
+            m->add_input.disconnectAll();
+            m->add_output.disconnectAll();
+            m->add_parameter.disconnectAll();
+            m->remove_input.disconnectAll();
+            m->remove_output.disconnectAll();
+            m->remove_parameter.disconnectAll();
+        }
+    }
 
     // ---------------- Port helpers ----------------
     void NodeItemPresenter::addInputPort(const std::string& name, const std::string& displayName)
@@ -0,0 +1,219 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/ConnectionPathView.hpp"
+#include "core/view/EdgeGeometryBatch.hpp"
+#include "core/view/FrameScheduler.hpp"
+#include <QtTest>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace nodeeditor::core::view;
+
+namespace
+{
+    using EdgeList = std::vector<std::unique_ptr<ConnectionPathView>>;
+
+    /** @brief @p count connected edges with varied, distinct end points. */
+    EdgeList
+    makeEdges(int count)
+    {
+        EdgeList edges;
+        for (int i = 0; i < count; ++i)
+        {
+            const QPointF from((i % 97) * 31., (i % 13) * 57.);
+            const QPointF to(from.x() + 150. + (i % 7) * 40., from.y() - 80. + (i % 11) * 23.);
+            ConnectionPortData in{from, QRectF(0., 0., 12., 12.), QStringLiteral("out"), QStringLiteral("a%1").arg(i), true};
+            ConnectionPortData out{to, QRectF(0., 0., 12., 12.), QStringLiteral("in"), QStringLiteral("b%1").arg(i), false};
+            edges.push_back(std::make_unique<ConnectionPathView>(in, out));
+        }
+        return edges;
+    }
+
+    bool
+    samePoint(const QPointF& a, const QPointF& b)
+    {
+        return std::abs(a.x() - b.x()) < 1e-9 && std::abs(a.y() - b.y()) < 1e-9;
+    }
+
+    /** @brief True if the batch left @p edge with the curve the scalar path computes. */
+    bool
+    matchesScalar(const ConnectionPathView& edge)
+    {
+        QPointF start;
+        QPointF end;
+        if (!edge.curveEnds(&start, &end))
+            return false;
+        const EdgeCurve expected = EdgeGeometryBatch::curveFor(start, end);
+        const EdgeCurve& actual = edge.curve();
+        if (actual.polyline.size() != expected.polyline.size())
+            return false;
+        for (int i = 0; i < expected.polyline.size(); ++i)
+            if (!samePoint(actual.polyline[i], expected.polyline[i]))
+                return false;
+        return samePoint(actual.ctrl1, expected.ctrl1) && samePoint(actual.ctrl2, expected.ctrl2) &&
+               actual.bounds == expected.bounds;
+    }
+
+    void
+    shiftAll(const EdgeList& edges, const QPointF& delta)
+    {
+        for (const auto& edge : edges)
+        {
+            edge->shiftEnds(delta, -delta);
+            EdgeGeometryBatch::instance().enqueue(edge.get());
+        }
+    }
+} // namespace
+
+/**
+ * @brief Batched curve evaluation gives the scalar result, on any thread split.
+ */
+class EdgeGeometryBatchTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void curveShape();
+    void batchMatchesScalar();
+    void workersMatchScalar();
+    void queueDeduplicatesAndCancels();
+    void scheduledFlushRunsOncePerTurn();
+};
+
+void
+EdgeGeometryBatchTest::init()
+{
+    auto& batch = EdgeGeometryBatch::instance();
+    batch.flush();
+    batch.resetStats();
+    batch.setParallelThreshold(2048);
+}
+
+void
+EdgeGeometryBatchTest::curveShape()
+{
+    const EdgeCurve curve = EdgeGeometryBatch::curveFor(QPointF(0., 0.), QPointF(200., 100.));
+
+    QCOMPARE(curve.polyline.size(), EdgeGeometryBatch::Segments + 1);
+    QCOMPARE(curve.polyline.front(), QPointF(0., 0.));
+    QCOMPARE(curve.polyline.back(), QPointF(200., 100.));
+
+    // Horizontal tangents at both ends, a quarter of the span in.
+    QCOMPARE(curve.ctrl1, QPointF(50., 0.));
+    QCOMPARE(curve.ctrl2, QPointF(150., 100.));
+    QCOMPARE(curve.bounds, QRectF(0., 0., 200., 100.));
+    for (const QPointF& p : curve.polyline)
+        QVERIFY(curve.bounds.adjusted(-1e-9, -1e-9, 1e-9, 1e-9).contains(p));
+}
+
+void
+EdgeGeometryBatchTest::batchMatchesScalar()
+{
+    // Odd count: pairs go through the SIMD path, the last edge through the scalar tail.
+    const EdgeList edges = makeEdges(7);
+    shiftAll(edges, QPointF(13., -9.));
+    EdgeGeometryBatch::instance().flush();
+
+    const auto stats = EdgeGeometryBatch::instance().stats();
+    QCOMPARE(stats.flushes, quint64(1));
+    QCOMPARE(stats.curves, quint64(7));
+    QCOMPARE(stats.lastChunks, 1);
+    for (const auto& edge : edges)
+        QVERIFY(matchesScalar(*edge));
+}
+
+void
+EdgeGeometryBatchTest::workersMatchScalar()
+{
+    auto& batch = EdgeGeometryBatch::instance();
+    batch.setParallelThreshold(1);
+
+    const EdgeList edges = makeEdges(3001);
+    shiftAll(edges, QPointF(-21., 5.));
+    batch.flush();
+
+    // 1024-edge chunks: two on the workers, one on the calling thread.
+    QCOMPARE(batch.stats().lastChunks, 3);
+    QCOMPARE(batch.stats().curves, quint64(3001));
+    for (const auto& edge : edges)
+        QVERIFY(matchesScalar(*edge));
+}
+
+void
+EdgeGeometryBatchTest::queueDeduplicatesAndCancels()
+{
+    auto& batch = EdgeGeometryBatch::instance();
+    const EdgeList edges = makeEdges(3);
+
+    batch.enqueue(edges[0].get());
+    batch.enqueue(edges[0].get());
+    batch.enqueue(edges[1].get());
+    batch.enqueue(edges[2].get());
+    batch.enqueue(nullptr);
+    QCOMPARE(batch.pendingCount(), std::size_t(3));
+
+    batch.cancel(edges[1].get());
+    QCOMPARE(batch.pendingCount(), std::size_t(2));
+
+    batch.flush();
+    QCOMPARE(batch.pendingCount(), std::size_t(0));
+    QCOMPARE(batch.stats().curves, quint64(2));
+
+    // An empty flush is not counted.
+    batch.flush();
+    QCOMPARE(batch.stats().flushes, quint64(1));
+}
+
+void
+EdgeGeometryBatchTest::scheduledFlushRunsOncePerTurn()
+{
+    auto& batch = EdgeGeometryBatch::instance();
+    const EdgeList edges = makeEdges(4);
+
+    shiftAll(edges, QPointF(4., 4.));
+    batch.scheduleFlush();
+    shiftAll(edges, QPointF(4., 4.));
+    batch.scheduleFlush();
+    QVERIFY(FrameScheduler::instance().isPending(&batch));
+    QCOMPARE(batch.stats().flushes, quint64(0));
+
+    FrameScheduler::instance().flush();
+    QCOMPARE(batch.stats().flushes, quint64(1));
+    QCOMPARE(batch.stats().curves, quint64(4));
+    for (const auto& edge : edges)
+        QVERIFY(matchesScalar(*edge));
+
+    // A direct flush drops the scheduled one.
+    shiftAll(edges, QPointF(1., 1.));
+    batch.scheduleFlush();
+    batch.flush();
+    QVERIFY(!FrameScheduler::instance().isPending(&batch));
+}
+
+QTEST_MAIN(EdgeGeometryBatchTest)
+#include "EdgeGeometryBatchTest.moc"
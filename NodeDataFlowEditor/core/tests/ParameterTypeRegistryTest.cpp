@@ -0,0 +1,177 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/ParameterControl.hpp"
+#include "core/view/ParameterTypeRegistry.hpp"
+#include <QtTest>
+#include <memory>
+
+using namespace nodeeditor::core::view;
+
+namespace
+{
+    using Registry = ParameterTypeRegistry;
+    using ControlPtr = std::unique_ptr<ParameterControl>;
+} // namespace
+
+/**
+ * @brief Built-in types, aliases, overrides and prototypes in ParameterTypeRegistry.
+ *
+ * The registry is process-wide; slots run in order and later ones see earlier registrations.
+ */
+class ParameterTypeRegistryTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void overrideBeforeFirstUse();
+    void builtinsAndAliases();
+    void unknownNames();
+    void overrideBuiltin();
+    void overrideThroughAlias();
+    void prototypeIsCloned();
+};
+
+void
+ParameterTypeRegistryTest::overrideBeforeFirstUse()
+{
+    // The very first registry call replaces a built-in: seeding must not undo it later.
+    const auto id = Registry::registerType("bool", {[] { return QVariant(QStringLiteral("yes")); },
+                                                    [] { return new TextParameterControl(); },
+                                                    nullptr});
+    QVERIFY(Registry::typeId("QString") != Registry::InvalidType);
+    QCOMPARE(Registry::typeId("bool"), id);
+
+    ControlPtr control(Registry::createControl(id));
+    QVERIFY(dynamic_cast<TextParameterControl*>(control.get()));
+    QCOMPARE(control->value(), QVariant(QStringLiteral("yes")));
+}
+
+void
+ParameterTypeRegistryTest::builtinsAndAliases()
+{
+    const auto text = Registry::typeId("QString");
+    const auto real = Registry::typeId("double");
+    QVERIFY(Registry::isRegistered(text));
+    QVERIFY(Registry::isRegistered(real));
+    QCOMPARE(Registry::typeId("string"), text);
+    QCOMPARE(Registry::typeId("float"), real);
+    QVERIFY(text != real);
+
+    ControlPtr number(Registry::createControl(Registry::typeId("int")));
+    auto* integer = dynamic_cast<NumberParameterControl*>(number.get());
+    QVERIFY(integer);
+    QVERIFY(integer->isInteger());
+    QCOMPARE(number->typeId(), Registry::typeId("int"));
+
+    ControlPtr floating(Registry::createControl(Registry::typeId("float")));
+    QVERIFY(dynamic_cast<NumberParameterControl*>(floating.get()));
+    QVERIFY(!static_cast<NumberParameterControl*>(floating.get())->isInteger());
+
+    ControlPtr field(Registry::createControl(Registry::typeId("string")));
+    QVERIFY(dynamic_cast<TextParameterControl*>(field.get()));
+
+    // Built-ins are painted only: no editor widget factory.
+    QVERIFY(!Registry::createEditor(text));
+}
+
+void
+ParameterTypeRegistryTest::unknownNames()
+{
+    QCOMPARE(Registry::typeId("no such type"), Registry::InvalidType);
+    QVERIFY(!Registry::isRegistered(Registry::InvalidType));
+    QVERIFY(!Registry::createControl(Registry::InvalidType));
+    QVERIFY(!Registry::createEditor(Registry::InvalidType));
+    QVERIFY(!Registry::createStorage(Registry::InvalidType).isValid());
+
+    // Interning alone does not register a type.
+    const auto id = Registry::intern("interned only");
+    QVERIFY(id != Registry::InvalidType);
+    QVERIFY(!Registry::isRegistered(id));
+    QVERIFY(!Registry::createControl(id));
+}
+
+void
+ParameterTypeRegistryTest::overrideBuiltin()
+{
+    const auto before = Registry::typeId("int");
+    const auto id = Registry::registerType("int", {[] { return QVariant(7); },
+                                                   [] {
+                                                       auto* control = new NumberParameterControl(true);
+                                                       control->setRange(0, 10);
+                                                       return control;
+                                                   },
+                                                   nullptr});
+
+    // Same id: parameters already created keep resolving to the type.
+    QCOMPARE(id, before);
+    QCOMPARE(Registry::createStorage(id), QVariant(7));
+
+    // The factory replaces the built-in prototype, and storage seeds the value.
+    ControlPtr control(Registry::createControl(id));
+    QVERIFY(control);
+    QCOMPARE(control->value(), QVariant(7));
+    QCOMPARE(control->typeId(), id);
+}
+
+void
+ParameterTypeRegistryTest::overrideThroughAlias()
+{
+    const auto real = Registry::typeId("double");
+    QCOMPARE(Registry::registerType("float", {[] { return QVariant(0.5); }, nullptr, nullptr}), real);
+
+    // An alias names the same entry, so "double" sees the new storage too.
+    QCOMPARE(Registry::createStorage(real), QVariant(0.5));
+
+    // No control factory and the prototype was dropped: the type is storage-only now.
+    QVERIFY(!Registry::createControl(real));
+}
+
+void
+ParameterTypeRegistryTest::prototypeIsCloned()
+{
+    const auto id = Registry::intern("percent");
+    auto prototype = std::make_unique<NumberParameterControl>(true);
+    prototype->setRange(0, 100);
+    prototype->setValue(50);
+    Registry::setPrototype(id, std::move(prototype));
+    QVERIFY(Registry::isRegistered(id));
+    QCOMPARE(Registry::createStorage(id), QVariant(50));
+
+    ControlPtr first(Registry::createControl(id));
+    ControlPtr second(Registry::createControl(id));
+    QVERIFY(first && second);
+    QVERIFY(first.get() != second.get());
+    QCOMPARE(first->value(), QVariant(50));
+    QCOMPARE(first->typeId(), id);
+
+    // Clones are independent of each other and of the prototype.
+    first->setValue(80);
+    QCOMPARE(second->value(), QVariant(50));
+    ControlPtr third(Registry::createControl(id));
+    QCOMPARE(third->value(), QVariant(50));
+}
+
+QTEST_MAIN(ParameterTypeRegistryTest)
+#include "ParameterTypeRegistryTest.moc"
@@ -0,0 +1,246 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/PortTable.hpp"
+#include <QtTest>
+
+using namespace nodeeditor::core::view;
+
+namespace
+{
+    using Side = PortTable::Side;
+
+    /** @brief Table with @p inputs and @p outputs rows named in0.., out0... */
+    void
+    fill(PortTable& table, int inputs, int outputs)
+    {
+        for (int i = 0; i < inputs; ++i)
+            table.append(Side::Input, QStringLiteral("in%1").arg(i), QString());
+        for (int i = 0; i < outputs; ++i)
+            table.append(Side::Output, QStringLiteral("out%1").arg(i), QString());
+    }
+} // namespace
+
+/**
+ * @brief Row storage, the scrolled window and the geometry arithmetic of PortTable.
+ */
+class PortTableTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void appendFindRemove();
+    void sidesAreIndependent();
+    void linksNeverGoNegative();
+    void scrolledWindow();
+    void columnHeight();
+    void rowRects();
+    void hitTest();
+};
+
+void
+PortTableTest::appendFindRemove()
+{
+    PortTable table;
+    QVERIFY(table.isEmpty());
+    fill(table, 3, 0);
+
+    QCOMPARE(table.count(Side::Input), 3);
+    QCOMPARE(table.find(Side::Input, QStringLiteral("in2")).index, 2);
+    QVERIFY(!table.find(Side::Input, QStringLiteral("missing")).isValid());
+
+    // An empty display name falls back to the internal name.
+    const auto ref = table.find(Side::Input, QStringLiteral("in1"));
+    QCOMPARE(table.row(ref).displayName, QStringLiteral("in1"));
+    QVERIFY(table.rowHeight() > 0.);
+
+    // Removal shifts the rows after it and keeps the name index in step.
+    QVERIFY(table.remove(Side::Input, QStringLiteral("in0")));
+    QVERIFY(!table.remove(Side::Input, QStringLiteral("in0")));
+    QCOMPARE(table.count(Side::Input), 2);
+    QCOMPARE(table.find(Side::Input, QStringLiteral("in1")).index, 0);
+    QCOMPARE(table.find(Side::Input, QStringLiteral("in2")).index, 1);
+    QCOMPARE(table.row({Side::Input, 1}).name, QStringLiteral("in2"));
+
+    table.clear();
+    QVERIFY(table.isEmpty());
+    QVERIFY(!table.find(Side::Input, QStringLiteral("in1")).isValid());
+}
+
+void
+PortTableTest::sidesAreIndependent()
+{
+    PortTable table;
+    table.append(Side::Input, QStringLiteral("value"), QString());
+    table.append(Side::Output, QStringLiteral("value"), QString());
+
+    QCOMPARE(table.find(Side::Input, QStringLiteral("value")).side, Side::Input);
+    QCOMPARE(table.find(Side::Output, QStringLiteral("value")).side, Side::Output);
+
+    QVERIFY(table.remove(Side::Output, QStringLiteral("value")));
+    QVERIFY(table.find(Side::Input, QStringLiteral("value")).isValid());
+    QCOMPARE(table.count(Side::Output), 0);
+}
+
+void
+PortTableTest::linksNeverGoNegative()
+{
+    PortTable table;
+    fill(table, 1, 0);
+    const PortTable::RowRef ref{Side::Input, 0};
+
+    table.addLinks(ref, 2);
+    QCOMPARE(table.row(ref).links, 2);
+    table.addLinks(ref, -5);
+    QCOMPARE(table.row(ref).links, 0);
+
+    // Out-of-range refs are ignored.
+    table.addLinks({Side::Input, 7}, 1);
+    table.addLinks(PortTable::RowRef(), 1);
+}
+
+void
+PortTableTest::scrolledWindow()
+{
+    PortTable table;
+    fill(table, 10, 3);
+
+    QVERIFY(!table.isVirtualized(Side::Input));
+    QCOMPARE(table.maxScrollOffset(), 0);
+
+    table.setMaxVisibleRows(4);
+    QVERIFY(table.isVirtualized(Side::Input));
+    QVERIFY(!table.isVirtualized(Side::Output));
+    QCOMPARE(table.maxScrollOffset(), 6);
+
+    table.setScrollOffset(100);
+    QCOMPARE(table.scrollOffset(), 6);
+    table.setScrollOffset(-3);
+    QCOMPARE(table.scrollOffset(), 0);
+
+    table.setScrollOffset(2);
+    QVERIFY(!table.isRowVisible({Side::Input, 1}));
+    QVERIFY(table.isRowVisible({Side::Input, 2}));
+    QVERIFY(table.isRowVisible({Side::Input, 5}));
+    QVERIFY(!table.isRowVisible({Side::Input, 6}));
+
+    // The short column is not scrolled at all.
+    for (int i = 0; i < 3; ++i)
+        QVERIFY(table.isRowVisible({Side::Output, i}));
+
+    // Removing rows re-clamps the offset.
+    for (int i = 0; i < 5; ++i)
+        QVERIFY(table.remove(Side::Input, QStringLiteral("in%1").arg(i)));
+    QCOMPARE(table.maxScrollOffset(), 1);
+    QCOMPARE(table.scrollOffset(), 1);
+
+    table.setMaxVisibleRows(0);
+    QVERIFY(!table.isVirtualized(Side::Input));
+    QCOMPARE(table.scrollOffset(), 0);
+}
+
+void
+PortTableTest::columnHeight()
+{
+    PortTable table;
+    fill(table, 10, 3);
+    table.setMaxVisibleRows(4);
+    table.setGeometry(QPointF(0., 0.), QPointF(200., 0.), 20.);
+
+    // A scrolled column adds an anchor strip above and below its window.
+    QCOMPARE(table.columnHeight(Side::Input), 4 * 20. + 2 * PortTable::AnchorStripHeight);
+    QCOMPARE(table.columnHeight(Side::Output), 3 * 20.);
+    QCOMPARE(table.columnHeight(Side::Output, 30.), 3 * 30.);
+}
+
+void
+PortTableTest::rowRects()
+{
+    PortTable table;
+    fill(table, 10, 3);
+    table.setMaxVisibleRows(4);
+    table.setScrollOffset(2);
+    const qreal pitch = table.rowHeight() + 6.;
+    table.setGeometry(QPointF(10., 40.), QPointF(200., 40.), pitch);
+
+    const qreal top = 40. + PortTable::AnchorStripHeight;
+    const QRectF first = table.rowRect({Side::Input, 2});
+    QCOMPARE(first.left(), 10.);
+    QCOMPARE(first.top(), top);
+    QCOMPARE(first.height(), table.rowHeight());
+    QCOMPARE(table.rowRect({Side::Input, 3}).top(), top + pitch);
+
+    // Rows scrolled out collapse onto the strip on their side of the window.
+    const QRectF above = table.rowRect({Side::Input, 0});
+    QCOMPARE(above, table.rowRect({Side::Input, 1}));
+    QCOMPARE(above.top(), 40.);
+    QCOMPARE(above.height(), PortTable::AnchorStripHeight);
+
+    const QRectF below = table.rowRect({Side::Input, 9});
+    QCOMPARE(below, table.rowRect({Side::Input, 6}));
+    QCOMPARE(below.top(), top + 4 * pitch);
+
+    // Outputs are right-aligned on the output edge.
+    QCOMPARE(table.rowRect({Side::Output, 0}).right(), 200.);
+    QCOMPARE(table.rowRect({Side::Output, 1}).top(), 40. + pitch);
+
+    QVERIFY(table.rowRect({Side::Input, 42}).isNull());
+    QVERIFY(table.rowRect(PortTable::RowRef()).isNull());
+}
+
+void
+PortTableTest::hitTest()
+{
+    PortTable table;
+    fill(table, 10, 3);
+    table.setMaxVisibleRows(4);
+    table.setScrollOffset(2);
+    const qreal pitch = table.rowHeight() + 6.;
+
+    // No geometry yet: nothing can be hit.
+    QVERIFY(!table.hitTest(QPointF(0., 0.)).isValid());
+
+    table.setGeometry(QPointF(0., 0.), QPointF(400., 0.), pitch);
+
+    for (int i = 2; i < 6; ++i)
+    {
+        const PortTable::RowRef ref{Side::Input, i};
+        QCOMPARE(table.hitTest(table.rowRect(ref).center()), ref);
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        const PortTable::RowRef ref{Side::Output, i};
+        QCOMPARE(table.hitTest(table.rowRect(ref).center()), ref);
+    }
+
+    // Anchor strips, the gap between rows and the space past the last row hit nothing.
+    QVERIFY(!table.hitTest(table.rowRect({Side::Input, 0}).center()).isValid());
+    const QRectF row = table.rowRect({Side::Input, 2});
+    QVERIFY(!table.hitTest(QPointF(row.center().x(), row.bottom() + 3.)).isValid());
+    QVERIFY(!table.hitTest(QPointF(row.center().x(), row.top() + 4 * pitch + 1.)).isValid());
+    QVERIFY(!table.hitTest(QPointF(row.right() + 1., row.center().y())).isValid());
+}
+
+QTEST_MAIN(PortTableTest)
+#include "PortTableTest.moc"
@@ -0,0 +1,244 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/FrameScheduler.hpp"
+#include "core/view/GraphScene.hpp"
+#include "core/view/SelectionSet.hpp"
+#include <QSignalSpy>
+#include <QtTest>
+#include <algorithm>
+#include <vector>
+
+using namespace nodeeditor::core;
+using view::SelectionSet;
+
+namespace
+{
+    using Indices = std::vector<SelectionSet::Index>;
+
+    /** @brief Set with @p count live indices, 0 to count - 1. */
+    void
+    acquire(SelectionSet& set, int count)
+    {
+        for (int i = 0; i < count; ++i)
+            set.acquire();
+    }
+
+    Indices
+    selected(const SelectionSet& set)
+    {
+        Indices indices;
+        set.forEachSelected([&indices](SelectionSet::Index index) { indices.push_back(index); });
+        return indices;
+    }
+} // namespace
+
+/**
+ * @brief Bit operations and delta ordering of SelectionSet, and one delta per scene batch.
+ */
+class SelectionSetTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void acquireReusesReleased();
+    void selectSingle();
+    void assignReportsAscendingDelta();
+    void addKeepsSelection();
+    void invertAcrossWords();
+    void selectAllAndClear();
+    void releasedIndicesStayDeselected();
+    void sceneReportsOneDeltaPerBatch();
+};
+
+void
+SelectionSetTest::acquireReusesReleased()
+{
+    SelectionSet set;
+    acquire(set, 3);
+    QCOMPARE(set.size(), std::size_t(3));
+    QCOMPARE(set.capacity(), std::size_t(3));
+
+    set.select(1);
+    set.release(1);
+    QVERIFY(!set.isLive(1));
+    QVERIFY(!set.isSelected(1));
+    QCOMPARE(set.count(), std::size_t(0));
+    QCOMPARE(set.size(), std::size_t(2));
+
+    // The released index comes back first, deselected.
+    QCOMPARE(set.acquire(), SelectionSet::Index(1));
+    QVERIFY(!set.isSelected(1));
+    QCOMPARE(set.acquire(), SelectionSet::Index(3));
+    QCOMPARE(set.capacity(), std::size_t(4));
+}
+
+void
+SelectionSetTest::selectSingle()
+{
+    SelectionSet set;
+    acquire(set, 2);
+
+    auto delta = set.select(1);
+    QCOMPARE(delta.selected, Indices{1});
+    QVERIFY(delta.deselected.empty());
+    QVERIFY(set.select(1).isEmpty());
+
+    delta = set.select(1, false);
+    QCOMPARE(delta.deselected, Indices{1});
+    QVERIFY(set.select(1, false).isEmpty());
+
+    // Unknown indices are ignored.
+    QVERIFY(set.select(7).isEmpty());
+    QCOMPARE(set.count(), std::size_t(0));
+}
+
+void
+SelectionSetTest::assignReportsAscendingDelta()
+{
+    SelectionSet set;
+    acquire(set, 200);
+
+    // Unsorted input over several words still yields one ascending delta.
+    auto delta = set.assign({150, 3, 70, 130, 70});
+    QCOMPARE(delta.selected, (Indices{3, 70, 130, 150}));
+    QVERIFY(delta.deselected.empty());
+    QCOMPARE(set.count(), std::size_t(4));
+
+    delta = set.assign({199, 70, 5, 900});
+    QCOMPARE(delta.selected, (Indices{5, 199}));
+    QCOMPARE(delta.deselected, (Indices{3, 130, 150}));
+    QCOMPARE(set.count(), std::size_t(3));
+    QCOMPARE(selected(set), (Indices{5, 70, 199}));
+
+    QVERIFY(set.assign({5, 70, 199}).isEmpty());
+}
+
+void
+SelectionSetTest::addKeepsSelection()
+{
+    SelectionSet set;
+    acquire(set, 100);
+    set.assign({10, 90});
+
+    const auto delta = set.add({90, 64, 1});
+    QCOMPARE(delta.selected, (Indices{1, 64}));
+    QVERIFY(delta.deselected.empty());
+    QCOMPARE(selected(set), (Indices{1, 10, 64, 90}));
+}
+
+void
+SelectionSetTest::invertAcrossWords()
+{
+    SelectionSet set;
+    acquire(set, 130);
+    set.assign({0, 63, 64, 129});
+
+    const auto delta = set.invert();
+    QCOMPARE(delta.selected.size(), std::size_t(126));
+    QCOMPARE(delta.deselected, (Indices{0, 63, 64, 129}));
+    QVERIFY(std::is_sorted(delta.selected.begin(), delta.selected.end()));
+    QCOMPARE(delta.selected.front(), SelectionSet::Index(1));
+    QCOMPARE(delta.selected.back(), SelectionSet::Index(128));
+    QCOMPARE(set.count(), std::size_t(126));
+
+    // Inverting twice restores the selection.
+    const auto back = set.invert();
+    QCOMPARE(back.selected, (Indices{0, 63, 64, 129}));
+    QCOMPARE(back.deselected.size(), std::size_t(126));
+    QCOMPARE(selected(set), (Indices{0, 63, 64, 129}));
+}
+
+void
+SelectionSetTest::selectAllAndClear()
+{
+    SelectionSet set;
+    acquire(set, 70);
+    set.select(69);
+
+    auto delta = set.selectAll();
+    QCOMPARE(delta.selected.size(), std::size_t(69));
+    QVERIFY(std::is_sorted(delta.selected.begin(), delta.selected.end()));
+    QCOMPARE(set.count(), std::size_t(70));
+    QVERIFY(set.selectAll().isEmpty());
+
+    delta = set.clear();
+    QCOMPARE(delta.deselected.size(), std::size_t(70));
+    QVERIFY(std::is_sorted(delta.deselected.begin(), delta.deselected.end()));
+    QCOMPARE(set.count(), std::size_t(0));
+    QVERIFY(set.clear().isEmpty());
+}
+
+void
+SelectionSetTest::releasedIndicesStayDeselected()
+{
+    SelectionSet set;
+    acquire(set, 10);
+    set.release(4);
+    set.release(7);
+
+    QCOMPARE(set.selectAll().selected, (Indices{0, 1, 2, 3, 5, 6, 8, 9}));
+    set.clear();
+    QCOMPARE(set.invert().selected, (Indices{0, 1, 2, 3, 5, 6, 8, 9}));
+    QVERIFY(set.assign({4, 7}).selected.empty());
+    QVERIFY(!set.isSelected(4));
+    QCOMPARE(set.count(), std::size_t(0));
+}
+
+void
+SelectionSetTest::sceneReportsOneDeltaPerBatch()
+{
+    constexpr int Nodes = 150;
+    NodeEditorScene scene;
+    for (int i = 0; i < Nodes; ++i)
+        scene.createNode(QStringLiteral("node%1").arg(i), QPointF((i % 15) * 300., (i / 15) * 300.));
+    view::FrameScheduler::instance().flush();
+
+    std::vector<SelectionSet::Delta> deltas;
+    scene.selection_changed.connect([&deltas](const SelectionSet::Delta& delta) { deltas.push_back(delta); });
+    QSignalSpy changed(&scene, &QGraphicsScene::selectionChanged);
+
+    scene.selectRect(QRectF(-100., -100., 15 * 300., 10 * 300.));
+    QCOMPARE(int(deltas.size()), 1);
+    QCOMPARE(changed.count(), 1);
+    QCOMPARE(deltas.back().selected.size(), std::size_t(Nodes));
+    QVERIFY(std::is_sorted(deltas.back().selected.begin(), deltas.back().selected.end()));
+    for (const auto index : deltas.back().selected)
+        QVERIFY(scene.selectableItem(index)->isSelected());
+
+    // Same rect again: nothing flips, nothing is reported.
+    scene.selectRect(QRectF(-100., -100., 15 * 300., 10 * 300.));
+    QCOMPARE(int(deltas.size()), 1);
+    QCOMPARE(changed.count(), 1);
+
+    scene.invertSelection();
+    QCOMPARE(int(deltas.size()), 2);
+    QCOMPARE(changed.count(), 2);
+    QCOMPARE(deltas.back().deselected.size(), std::size_t(Nodes));
+    QVERIFY(deltas.back().selected.empty());
+    QVERIFY(scene.selectedItems().isEmpty());
+}
+
+QTEST_MAIN(SelectionSetTest)
+#include "SelectionSetTest.moc"
@@ -0,0 +1,248 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/SpatialGrid.hpp"
+#include <QRandomGenerator>
+#include <QtTest>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+using namespace nodeeditor::core::view;
+
+namespace
+{
+    using Grid = SpatialGrid<int>;
+
+    /** @brief Every value reported by a query, in visiting order (duplicates kept). */
+    std::vector<int>
+    collect(const Grid& grid, const QRectF& rect)
+    {
+        std::vector<int> values;
+        grid.query(rect, [&values](const int& value, const QRectF&) { values.push_back(value); });
+        return values;
+    }
+
+    std::vector<int>
+    sorted(std::vector<int> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+} // namespace
+
+/**
+ * @brief Incremental updates, oversized entries and duplicate-free queries in SpatialGrid.
+ */
+class SpatialGridTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void insertAndQuery();
+    void pointBoundsMatch();
+    void relocateWithinCells();
+    void relocateAcrossCells();
+    void oversizedEntries();
+    void visitsEachValueOnce();
+    void removeAndClear();
+    void matchesBruteForce();
+};
+
+void
+SpatialGridTest::insertAndQuery()
+{
+    Grid grid(100.);
+    grid.insert(1, QRectF(10., 10., 20., 20.));
+    grid.insert(2, QRectF(250., 250., 20., 20.));
+
+    QCOMPARE(grid.size(), std::size_t(2));
+    QVERIFY(grid.contains(1));
+    QCOMPARE(grid.bounds(2), QRectF(250., 250., 20., 20.));
+    QCOMPARE(collect(grid, QRectF(0., 0., 50., 50.)), std::vector<int>{1});
+    QCOMPARE(sorted(collect(grid, QRectF(0., 0., 300., 300.))), (std::vector<int>{1, 2}));
+    QVERIFY(collect(grid, QRectF(100., 100., 50., 50.)).empty());
+
+    // Queries and bounds are normalized.
+    QCOMPARE(collect(grid, QRectF(50., 50., -50., -50.)), std::vector<int>{1});
+    grid.insert(3, QRectF(-10., -10., -20., -20.));
+    QCOMPARE(grid.bounds(3), QRectF(-30., -30., 20., 20.));
+}
+
+void
+SpatialGridTest::pointBoundsMatch()
+{
+    // Overlap is closed, so zero-sized bounds and touching edges still match.
+    Grid grid(100.);
+    grid.insert(1, QRectF(QPointF(40., 40.), QSizeF()));
+    QCOMPARE(collect(grid, QRectF(40., 40., 0., 0.)), std::vector<int>{1});
+    QCOMPARE(collect(grid, QRectF(0., 0., 40., 40.)), std::vector<int>{1});
+    QVERIFY(collect(grid, QRectF(0., 0., 39., 39.)).empty());
+}
+
+void
+SpatialGridTest::relocateWithinCells()
+{
+    Grid grid(100.);
+    grid.insert(1, QRectF(10., 10., 20., 20.));
+    grid.insert(1, QRectF(50., 50., 20., 20.));
+
+    QCOMPARE(grid.size(), std::size_t(1));
+    QCOMPARE(grid.bounds(1), QRectF(50., 50., 20., 20.));
+
+    // The stored bounds moved even though the cells did not.
+    QVERIFY(collect(grid, QRectF(10., 10., 20., 20.)).empty());
+    QCOMPARE(collect(grid, QRectF(55., 55., 1., 1.)), std::vector<int>{1});
+}
+
+void
+SpatialGridTest::relocateAcrossCells()
+{
+    Grid grid(100.);
+    grid.insert(1, QRectF(10., 10., 20., 20.));
+    grid.insert(1, QRectF(1010., 510., 150., 20.));
+
+    QCOMPARE(grid.size(), std::size_t(1));
+    QVERIFY(collect(grid, QRectF(0., 0., 100., 100.)).empty());
+    QCOMPARE(collect(grid, QRectF(1000., 500., 10., 100.)), std::vector<int>{1});
+    QCOMPARE(collect(grid, QRectF(1150., 500., 10., 100.)), std::vector<int>{1});
+
+    // And back again: nothing is left behind in the cells it left.
+    grid.insert(1, QRectF(10., 10., 20., 20.));
+    QVERIFY(collect(grid, QRectF(1000., 500., 200., 100.)).empty());
+    QCOMPARE(collect(grid, QRectF(0., 0., 100., 100.)), std::vector<int>{1});
+}
+
+void
+SpatialGridTest::oversizedEntries()
+{
+    Grid grid(10.);
+    const QRectF large(0., 0., 1000., 1000.); // 101 x 101 cells, far over MaxCellsPerEntry.
+    grid.insert(1, large);
+    grid.insert(2, QRectF(5., 5., 1., 1.));
+
+    // Found from anywhere it covers, and only there.
+    QCOMPARE(sorted(collect(grid, QRectF(4., 4., 4., 4.))), (std::vector<int>{1, 2}));
+    QCOMPARE(collect(grid, QRectF(990., 990., 5., 5.)), std::vector<int>{1});
+    QVERIFY(collect(grid, QRectF(1010., 1010., 5., 5.)).empty());
+
+    // Oversized to small, then small to oversized.
+    grid.insert(1, QRectF(500., 500., 5., 5.));
+    QVERIFY(collect(grid, QRectF(990., 990., 5., 5.)).empty());
+    QCOMPARE(collect(grid, QRectF(501., 501., 1., 1.)), std::vector<int>{1});
+
+    grid.insert(2, QRectF(-2000., -2000., 4000., 10.));
+    QCOMPARE(collect(grid, QRectF(1500., -1995., 1., 1.)), std::vector<int>{2});
+    QVERIFY(collect(grid, QRectF(5., 5., 1., 1.)).empty());
+
+    grid.remove(2);
+    QVERIFY(collect(grid, QRectF(1500., -1995., 1., 1.)).empty());
+}
+
+void
+SpatialGridTest::visitsEachValueOnce()
+{
+    Grid grid(10.);
+    grid.insert(1, QRectF(5., 5., 30., 30.));   // 4 x 4 cells.
+    grid.insert(2, QRectF(0., 0., 5000., 5.));  // Oversized.
+    grid.insert(3, QRectF(12., 12., 1., 1.));
+
+    // Small query: walks the 2 x 2 cells it covers, three of which hold value 1.
+    QCOMPARE(sorted(collect(grid, QRectF(0., 0., 15., 15.))), (std::vector<int>{1, 2, 3}));
+
+    // Query larger than the populated area: walks the populated cells instead.
+    QCOMPARE(sorted(collect(grid, QRectF(-1e6, -1e6, 2e6, 2e6))), (std::vector<int>{1, 2, 3}));
+
+    // Stamps advance per query, so a value is reported again by the next one.
+    for (int i = 0; i < 3; ++i)
+        QCOMPARE(collect(grid, QRectF(6., 6., 1., 1.)), std::vector<int>{1});
+}
+
+void
+SpatialGridTest::removeAndClear()
+{
+    Grid grid(10.);
+    grid.insert(1, QRectF(0., 0., 50., 50.));
+    grid.insert(2, QRectF(20., 20., 5., 5.));
+
+    grid.remove(1);
+    grid.remove(42); // Absent: no-op.
+    QVERIFY(!grid.contains(1));
+    QVERIFY(grid.bounds(1).isNull());
+    QCOMPARE(grid.size(), std::size_t(1));
+    QCOMPARE(collect(grid, QRectF(0., 0., 50., 50.)), std::vector<int>{2});
+
+    grid.clear();
+    QCOMPARE(grid.size(), std::size_t(0));
+    QVERIFY(collect(grid, QRectF(0., 0., 50., 50.)).empty());
+
+    // Usable again after clear().
+    grid.insert(1, QRectF(0., 0., 5., 5.));
+    QCOMPARE(collect(grid, QRectF(0., 0., 5., 5.)), std::vector<int>{1});
+}
+
+void
+SpatialGridTest::matchesBruteForce()
+{
+    QRandomGenerator random(39);
+    const auto randomRect = [&random](qreal extent, qreal maxSize) {
+        return QRectF(random.bounded(extent), random.bounded(extent), random.bounded(maxSize), random.bounded(maxSize));
+    };
+
+    Grid grid(64.);
+    std::map<int, QRectF> reference;
+    for (int i = 0; i < 2000; ++i)
+    {
+        // Mostly small rects, a few long enough to be oversized.
+        const QRectF rect = randomRect(4000., i % 50 == 0 ? 3000. : 80.);
+        grid.insert(i, rect);
+        reference[i] = rect.normalized();
+    }
+    // Move a third of them, some far.
+    for (int i = 0; i < 2000; i += 3)
+    {
+        const QRectF rect = randomRect(6000., i % 30 == 0 ? 3000. : 80.);
+        grid.insert(i, rect);
+        reference[i] = rect.normalized();
+    }
+    for (int i = 1; i < 2000; i += 7)
+    {
+        grid.remove(i);
+        reference.erase(i);
+    }
+
+    for (int q = 0; q < 200; ++q)
+    {
+        const QRectF probe = randomRect(6000., q % 10 == 0 ? 6000. : 400.);
+        std::vector<int> expected;
+        for (const auto& [value, rect] : reference)
+            if (rect.left() <= probe.right() && probe.left() <= rect.right() &&
+                rect.top() <= probe.bottom() && probe.top() <= rect.bottom())
+                expected.push_back(value);
+        QCOMPARE(sorted(collect(grid, probe)), expected);
+    }
+}
+
+QTEST_MAIN(SpatialGridTest)
+#include "SpatialGridTest.moc"
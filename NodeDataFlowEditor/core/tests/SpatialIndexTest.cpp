@@ -0,0 +1,247 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/FrameScheduler.hpp"
+#include "core/view/NodeItemView.hpp"
+#include "core/view/SpatialIndex.hpp"
+#include <QtTest>
+
+using namespace nodeeditor::core::view;
+using nodeeditor::common::taggable::TagBitMask;
+
+namespace
+{
+    using Side = PortTable::Side;
+
+    TagBitMask
+    tags(std::initializer_list<std::size_t> bits)
+    {
+        TagBitMask mask;
+        for (const std::size_t bit : bits)
+            mask.set(bit);
+        return mask;
+    }
+
+    /**
+     * @brief Three nodes in an index.
+     *
+     * "source" has output "out" and input "loop", "target" has inputs in0..in2
+     * stacked top to bottom, "sibling" has output "other".
+     */
+    struct Fixture
+    {
+        NodeItemView source{QStringLiteral("source")};
+        NodeItemView target{QStringLiteral("target")};
+        NodeItemView sibling{QStringLiteral("sibling")};
+        SpatialIndex index;
+
+        Fixture()
+        {
+            source.addOutputRow(QStringLiteral("out"));
+            source.addInputRow(QStringLiteral("loop"));
+            for (int i = 0; i < 3; ++i)
+                target.addInputRow(QStringLiteral("in%1").arg(i));
+            sibling.addOutputRow(QStringLiteral("other"));
+
+            source.setPos(0., 0.);
+            target.setPos(400., 0.);
+            sibling.setPos(0., 400.);
+            FrameScheduler::instance().flush();
+
+            for (NodeItemView* node : {&source, &target, &sibling})
+                index.addNode(node);
+        }
+
+        void
+        tag(NodeItemView& node, Side side, const QString& name, const TagBitMask& mask)
+        {
+            node.setRowTags(side, name, mask);
+            index.refreshNode(&node);
+        }
+
+        QRectF
+        rect(const NodeItemView& node, Side side, const QString& name) const
+        {
+            QRectF r;
+            node.rowSceneRect(side, name, &r);
+            return r;
+        }
+
+        /** @brief The drag source: output "out" of "source", as the index reports it. */
+        SpatialIndex::PortHit
+        sourceHit() const
+        {
+            const auto hits = index.portsWithin(rect(source, Side::Output, QStringLiteral("out")).center(), 0.);
+            return hits.empty() ? SpatialIndex::PortHit() : hits.front();
+        }
+
+        std::optional<SpatialIndex::PortHit>
+        snapNear(const QPointF& point, qreal radius) const
+        {
+            return index.nearestCompatiblePort(point, sourceHit(), radius);
+        }
+
+        QPointF
+        input(int i) const
+        {
+            return rect(target, Side::Input, QStringLiteral("in%1").arg(i)).center();
+        }
+    };
+} // namespace
+
+/**
+ * @brief Tag, side, node and distance rules of SpatialIndex::nearestCompatiblePort.
+ */
+class SpatialIndexTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void tagsCompatible();
+    void indexesRows();
+    void untaggedAcceptsAnything();
+    void needsCommonTag();
+    void skipsIncompatibleForNearestCompatible();
+    void rejectsSameNode();
+    void rejectsSameSide();
+    void respectsRadius();
+};
+
+void
+SpatialIndexTest::tagsCompatible()
+{
+    QVERIFY(SpatialIndex::tagsCompatible(TagBitMask(), TagBitMask()));
+    QVERIFY(SpatialIndex::tagsCompatible(tags({0}), TagBitMask()));
+    QVERIFY(SpatialIndex::tagsCompatible(TagBitMask(), tags({1})));
+    QVERIFY(!SpatialIndex::tagsCompatible(tags({0}), tags({1})));
+    QVERIFY(SpatialIndex::tagsCompatible(tags({0, 1}), tags({1})));
+    QVERIFY(SpatialIndex::tagsCompatible(tags({3, 31}), tags({2, 31})));
+}
+
+void
+SpatialIndexTest::indexesRows()
+{
+    Fixture f;
+    QCOMPARE(f.index.nodeCount(), std::size_t(3));
+    QCOMPARE(f.index.portCount(), std::size_t(6));
+
+    const auto hit = f.sourceHit();
+    QCOMPARE(hit.node, &f.source);
+    QCOMPARE(hit.side, Side::Output);
+    QCOMPARE(hit.name, QStringLiteral("out"));
+    QCOMPARE(hit.distance, 0.);
+
+    // Tags are re-read on refresh.
+    f.tag(f.source, Side::Output, QStringLiteral("out"), tags({4}));
+    QCOMPARE(f.sourceHit().tags, tags({4}));
+}
+
+void
+SpatialIndexTest::untaggedAcceptsAnything()
+{
+    Fixture f;
+    f.tag(f.source, Side::Output, QStringLiteral("out"), tags({0}));
+
+    const auto hit = f.snapNear(f.input(0), 2.);
+    QVERIFY(hit);
+    QCOMPARE(hit->node, &f.target);
+    QCOMPARE(hit->side, Side::Input);
+    QCOMPARE(hit->name, QStringLiteral("in0"));
+    QCOMPARE(hit->distance, 0.);
+
+    // An untagged source connects to tagged ports as well.
+    f.tag(f.source, Side::Output, QStringLiteral("out"), TagBitMask());
+    f.tag(f.target, Side::Input, QStringLiteral("in0"), tags({5}));
+    QVERIFY(f.snapNear(f.input(0), 2.));
+}
+
+void
+SpatialIndexTest::needsCommonTag()
+{
+    Fixture f;
+    f.tag(f.source, Side::Output, QStringLiteral("out"), tags({0}));
+    f.tag(f.target, Side::Input, QStringLiteral("in0"), tags({1}));
+    QVERIFY(!f.snapNear(f.input(0), 2.));
+
+    f.tag(f.target, Side::Input, QStringLiteral("in0"), tags({0, 1}));
+    const auto hit = f.snapNear(f.input(0), 2.);
+    QVERIFY(hit);
+    QCOMPARE(hit->name, QStringLiteral("in0"));
+    QCOMPARE(hit->tags, tags({0, 1}));
+}
+
+void
+SpatialIndexTest::skipsIncompatibleForNearestCompatible()
+{
+    Fixture f;
+    f.tag(f.source, Side::Output, QStringLiteral("out"), tags({0}));
+    f.tag(f.target, Side::Input, QStringLiteral("in0"), tags({1}));
+    f.tag(f.target, Side::Input, QStringLiteral("in1"), tags({0}));
+    f.tag(f.target, Side::Input, QStringLiteral("in2"), tags({0}));
+
+    // in0 is under the point but incompatible; in1 is the nearer of the two that fit.
+    const auto hit = f.snapNear(f.input(0), 300.);
+    QVERIFY(hit);
+    QCOMPARE(hit->name, QStringLiteral("in1"));
+    QVERIFY(hit->distance > 0.);
+    QCOMPARE(hit->anchor, f.input(1));
+}
+
+void
+SpatialIndexTest::rejectsSameNode()
+{
+    Fixture f;
+    const QPointF loop = f.rect(f.source, Side::Input, QStringLiteral("loop")).center();
+
+    // The source's own input is under the point, and nothing else is in range.
+    QCOMPARE(f.index.portsWithin(loop, 2.).size(), std::size_t(1));
+    QVERIFY(!f.snapNear(loop, 2.));
+}
+
+void
+SpatialIndexTest::rejectsSameSide()
+{
+    Fixture f;
+    const QPointF other = f.rect(f.sibling, Side::Output, QStringLiteral("other")).center();
+    QCOMPARE(f.index.portsWithin(other, 2.).size(), std::size_t(1));
+    QVERIFY(!f.snapNear(other, 2.));
+}
+
+void
+SpatialIndexTest::respectsRadius()
+{
+    Fixture f;
+    const QRectF in0 = f.rect(f.target, Side::Input, QStringLiteral("in0"));
+    const QPointF point(in0.left() - 30., in0.center().y());
+
+    QVERIFY(!f.snapNear(point, 10.));
+
+    const auto hit = f.snapNear(point, 40.);
+    QVERIFY(hit);
+    QCOMPARE(hit->name, QStringLiteral("in0"));
+    QCOMPARE(hit->distance, 30.);
+}
+
+QTEST_MAIN(SpatialIndexTest)
+#include "SpatialIndexTest.moc"
@@ -0,0 +1,120 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/EditableArrowItemView.hpp"
+#include "core/view/TextLayoutCache.hpp"
+#include <QtTest>
+
+using namespace nodeeditor::core::view;
+
+/**
+ * @brief Sharing and least-recently-used eviction in TextLayoutCache.
+ */
+class TextLayoutCacheTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void sharesIdenticalLabels();
+    void keysOnFont();
+    void evictsLeastRecentlyUsed();
+};
+
+void
+TextLayoutCacheTest::init()
+{
+    TextLayoutCache::instance().clear();
+}
+
+void
+TextLayoutCacheTest::sharesIdenticalLabels()
+{
+    auto& cache = TextLayoutCache::instance();
+    const QFont& font = EditableArrowItemView::labelFont();
+    const quint64 misses = cache.misses();
+    const quint64 hits = cache.hits();
+
+    const auto first = cache.layout(QStringLiteral("input1"), font);
+    const auto second = cache.layout(QStringLiteral("input1"), font);
+
+    QCOMPARE(cache.size(), 1);
+    QCOMPARE(cache.misses() - misses, quint64(1));
+    QCOMPARE(cache.hits() - hits, quint64(1));
+    QVERIFY(second.text == first.text);
+    QCOMPARE(second.size, first.size);
+    QVERIFY(first.size.width() > 2 * TextLayoutCache::Margin);
+    QVERIFY(first.size.height() > 2 * TextLayoutCache::Margin);
+}
+
+void
+TextLayoutCacheTest::keysOnFont()
+{
+    auto& cache = TextLayoutCache::instance();
+    QFont bold = EditableArrowItemView::labelFont();
+    bold.setBold(true);
+
+    cache.layout(QStringLiteral("input1"), EditableArrowItemView::labelFont());
+    cache.layout(QStringLiteral("input1"), bold);
+
+    QCOMPARE(cache.size(), 2);
+}
+
+void
+TextLayoutCacheTest::evictsLeastRecentlyUsed()
+{
+    auto& cache = TextLayoutCache::instance();
+    const QFont& font = EditableArrowItemView::labelFont();
+    const auto label = [](int i) { return QStringLiteral("label%1").arg(i); };
+
+    for (int i = 0; i < TextLayoutCache::MaxEntries; ++i)
+        cache.layout(label(i), font);
+    QCOMPARE(cache.size(), TextLayoutCache::MaxEntries);
+
+    // Touch the oldest entry: label1 becomes the least recently used one.
+    cache.layout(label(0), font);
+
+    const quint64 evictions = cache.evictions();
+    cache.layout(QStringLiteral("newcomer"), font);
+    QCOMPARE(cache.evictions() - evictions, quint64(1));
+    QCOMPARE(cache.size(), TextLayoutCache::MaxEntries);
+
+    quint64 hits = cache.hits();
+    cache.layout(label(0), font);
+    QCOMPARE(cache.hits() - hits, quint64(1));
+
+    // label1 was evicted; shaping it again evicts the next oldest, label2.
+    const quint64 misses = cache.misses();
+    cache.layout(label(1), font);
+    QCOMPARE(cache.misses() - misses, quint64(1));
+
+    hits = cache.hits();
+    cache.layout(label(3), font);
+    QCOMPARE(cache.hits() - hits, quint64(1));
+    cache.layout(label(2), font);
+    QCOMPARE(cache.hits() - hits, quint64(1));
+}
+
+QTEST_MAIN(TextLayoutCacheTest)
+#include "TextLayoutCacheTest.moc"
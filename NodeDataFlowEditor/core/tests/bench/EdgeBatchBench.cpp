@@ -0,0 +1,139 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/ConnectionPathView.hpp"
+#include "core/view/EdgeGeometryBatch.hpp"
+#include <QtTest>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace nodeeditor::core::view;
+
+namespace
+{
+    constexpr int Edges = 50000;
+
+    enum class Mode
+    {
+        PerEdge, ///< updatePath on every edge, one curve at a time.
+        Batch,   ///< One EdgeGeometryBatch flush on the calling thread.
+        Workers  ///< One EdgeGeometryBatch flush split over the worker pool.
+    };
+} // namespace
+Q_DECLARE_METATYPE(Mode)
+
+/**
+ * @brief Rebuilding 50k connection curves, as a drag of every node would.
+ */
+class EdgeBatchBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void rebuild_data();
+    void rebuild();
+
+private:
+    std::vector<std::unique_ptr<ConnectionPathView>> m_edges;
+};
+
+void
+EdgeBatchBench::initTestCase()
+{
+    m_edges.reserve(Edges);
+    for (int i = 0; i < Edges; ++i)
+    {
+        const QPointF from((i % 250) * 240., (i / 250) * 120.);
+        const QPointF to(from.x() + 180., from.y() + (i % 5 - 2) * 60. + 1.);
+        ConnectionPortData in{from, QRectF(0., 0., 12., 12.), QStringLiteral("out"), QStringLiteral("a%1").arg(i), true};
+        ConnectionPortData out{to, QRectF(0., 0., 12., 12.), QStringLiteral("in"), QStringLiteral("b%1").arg(i), false};
+        m_edges.push_back(std::make_unique<ConnectionPathView>(in, out));
+    }
+}
+
+void
+EdgeBatchBench::cleanupTestCase()
+{
+    m_edges.clear();
+    EdgeGeometryBatch::instance().setParallelThreshold(2048);
+}
+
+void
+EdgeBatchBench::rebuild_data()
+{
+    QTest::addColumn<Mode>("mode");
+    QTest::newRow("per edge") << Mode::PerEdge;
+    QTest::newRow("batch, GUI thread") << Mode::Batch;
+    QTest::newRow("batch, workers") << Mode::Workers;
+}
+
+void
+EdgeBatchBench::rebuild()
+{
+    QFETCH(Mode, mode);
+
+    auto& batch = EdgeGeometryBatch::instance();
+    batch.setParallelThreshold(mode == Mode::Workers ? 2048 : std::numeric_limits<std::size_t>::max());
+    batch.resetStats();
+
+    // Alternate the direction so the edges stay where they started.
+    qreal step = 4.;
+    QBENCHMARK
+    {
+        step = -step;
+        for (const auto& edge : m_edges)
+        {
+            edge->shiftEnds(QPointF(step, step), QPointF(-step, 0.));
+            if (mode == Mode::PerEdge)
+                edge->updatePath();
+            else
+                batch.enqueue(edge.get());
+        }
+        batch.flush();
+    }
+
+    // Every edge must end up with the curve updatePath would have drawn.
+    for (const auto& edge : m_edges)
+    {
+        QPointF start;
+        QPointF end;
+        QVERIFY(edge->curveEnds(&start, &end));
+        QCOMPARE(edge->curve().end, EdgeGeometryBatch::curveFor(start, end).end);
+    }
+
+    if (mode == Mode::PerEdge)
+        return;
+
+    const auto stats = batch.stats();
+    QCOMPARE(stats.curves, stats.flushes * quint64(Edges));
+    QCOMPARE(stats.lastChunks, mode == Mode::Workers ? (Edges + 1023) / 1024 : 1);
+    qInfo("%llu flushes of %d curves, last %.2f ms in %d chunk(s)", static_cast<unsigned long long>(stats.flushes),
+          Edges, stats.lastFlushNs / 1e6, stats.lastChunks);
+}
+
+QTEST_MAIN(EdgeBatchBench)
+#include "EdgeBatchBench.moc"
@@ -0,0 +1,149 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "core/presenter/NodeItemPresenter.hpp"
+#include "core/view/FrameScheduler.hpp"
+#include "core/view/GraphScene.hpp"
+#include "core/view/GraphView.hpp"
+#include "core/view/NodeItemView.hpp"
+#include <QColor>
+#include <QFile>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QPointF>
+#include <QScrollBar>
+#include <QString>
+#include <QWheelEvent>
+#include <algorithm>
+#include <cmath>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
+namespace nodeeditor::core::bench
+{
+    /** @brief Distance between generated nodes, wide enough for a node with short labels. */
+    constexpr qreal NodeSpacing = 240.0;
+
+    /**
+     * @brief Fill @p scene with @p count nodes on a square grid.
+     * @param rows Painted input and output rows per node.
+     * @param colours Distinct title colours, so bodies stop sharing one cache entry.
+     * @return Scene rect covered by the grid.
+     */
+    inline QRectF
+    populate(NodeEditorScene& scene, int count, int rows = 2, int colours = 1)
+    {
+        const int columns = std::max(1, int(std::ceil(std::sqrt(double(count)))));
+        for (int i = 0; i < count; ++i)
+        {
+            const QString name = QStringLiteral("node%1").arg(i);
+            auto node = scene.createNode(name, QPointF((i % columns) * NodeSpacing, (i / columns) * NodeSpacing));
+            if (colours > 1)
+                if (auto* nodeView = dynamic_cast<view::NodeItemView*>(node->view().get()))
+                {
+                    const int c = i % colours;
+                    nodeView->setNodeNameColor(QColor::fromHsv(c % 360, 96 + (c / 360) % 160, 200));
+                }
+            for (int r = 0; r < rows; ++r)
+            {
+                scene.addInputRow(name, QStringLiteral("in%1").arg(r));
+                scene.addOutputRow(name, QStringLiteral("out%1").arg(r));
+            }
+        }
+        view::FrameScheduler::instance().flush();
+        return QRectF(0., 0., columns * NodeSpacing, ((count + columns - 1) / columns) * NodeSpacing);
+    }
+
+    /**
+     * @brief Pan step for frame @p frame: runs diagonally, then back, every @p legFrames frames.
+     *
+     * Keeps long benchmark runs over the generated grid instead of drifting into empty scene.
+     */
+    inline QPoint
+    zigZag(int frame, const QPoint& step = QPoint(48, 24), int legFrames = 200)
+    {
+        return (frame / legFrames) % 2 ? -step : step;
+    }
+
+    /**
+     * @brief Scroll @p view by @p delta viewport pixels and paint the frame.
+     *
+     * Deferred work (rasterized bodies landing, viewport reports) runs first,
+     * as it would between two frames of a real pan.
+     * @return Wall time of the frame in nanoseconds.
+     */
+    inline qint64
+    panFrame(view::GraphView& view, const QPoint& delta)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        view.horizontalScrollBar()->setValue(view.horizontalScrollBar()->value() + delta.x());
+        view.verticalScrollBar()->setValue(view.verticalScrollBar()->value() + delta.y());
+        QCoreApplication::processEvents();
+        view::FrameScheduler::instance().flush();
+        view.viewport()->repaint();
+        return timer.nsecsElapsed();
+    }
+
+    /**
+     * @brief Turn the wheel over the viewport centre by @p notches and paint the frame.
+     *
+     * Goes through the viewport's event handling like a real wheel, so zoom
+     * gestures start and their settle timer restarts as they would.
+     * @return Wall time of the frame in nanoseconds.
+     */
+    inline qint64
+    zoomFrame(view::GraphView& view, int notches)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        const QPointF centre = QRectF(view.viewport()->rect()).center();
+        QWheelEvent wheel(centre, view.viewport()->mapToGlobal(centre.toPoint()), QPoint(), QPoint(0, notches * 120),
+                          Qt::NoButton, Qt::NoModifier, Qt::NoScrollPhase, false);
+        QCoreApplication::sendEvent(view.viewport(), &wheel);
+        QCoreApplication::processEvents();
+        view::FrameScheduler::instance().flush();
+        view.viewport()->repaint();
+        return timer.nsecsElapsed();
+    }
+
+    /** @brief Resident set size of this process, or 0 where it cannot be read. */
+    inline qint64
+    residentBytes()
+    {
+#ifdef Q_OS_LINUX
+        QFile statm(QStringLiteral("/proc/self/statm"));
+        if (!statm.open(QIODevice::ReadOnly))
+            return 0;
+        const QList<QByteArray> fields = statm.readAll().split(' ');
+        return fields.size() > 1 ? fields[1].toLongLong() * sysconf(_SC_PAGESIZE) : 0;
+#else
+        return 0;
+#endif
+    }
+} // namespace nodeeditor::core::bench
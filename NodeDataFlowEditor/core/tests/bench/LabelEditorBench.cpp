@@ -0,0 +1,108 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "GeneratedScene.hpp"
+#include "core/view/EditableArrowItemView.hpp"
+#include <QApplication>
+#include <QGraphicsScene>
+#include <QtTest>
+
+using namespace nodeeditor::core;
+
+namespace
+{
+    constexpr int Nodes = 5000;
+    constexpr int PortsPerSide = 5; ///< 5000 nodes * 10 ports = 50k labels.
+} // namespace
+
+/**
+ * @brief Cost of port labels now that their inline editor only exists while editing.
+ */
+class LabelEditorBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void editorOnDemand();
+    void construct50kPorts();
+};
+
+void
+LabelEditorBench::editorOnDemand()
+{
+    QGraphicsScene scene;
+    auto* label = new view::EditableArrowItemView(QStringLiteral("label"));
+    scene.addItem(label);
+
+    QString committed;
+    label->setOnTextChanged([&committed](const QString& text) { committed = text; });
+
+    const int widgets = QApplication::allWidgets().size();
+    QVERIFY(!label->isEditing());
+
+    label->startEditing();
+    QVERIFY(label->isEditing());
+    QCOMPARE(QApplication::allWidgets().size(), widgets + 1);
+
+    label->finishEditing();
+    QVERIFY(!label->isEditing());
+    QCOMPARE(committed, QStringLiteral("label"));
+
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    QCOMPARE(QApplication::allWidgets().size(), widgets);
+}
+
+void
+LabelEditorBench::construct50kPorts()
+{
+    NodeEditorScene scene;
+    const int widgets = QApplication::allWidgets().size();
+    const qint64 before = bench::residentBytes();
+
+    QBENCHMARK_ONCE
+    {
+        bench::populate(scene, Nodes, 0);
+        for (int i = 0; i < Nodes; ++i)
+        {
+            const QString name = QStringLiteral("node%1").arg(i);
+            for (int p = 0; p < PortsPerSide; ++p)
+            {
+                scene.addInputPort(name, QStringLiteral("in%1").arg(p), QStringLiteral("input %1").arg(p));
+                scene.addOutputPort(name, QStringLiteral("out%1").arg(p), QStringLiteral("output %1").arg(p));
+            }
+        }
+        view::FrameScheduler::instance().flush();
+    }
+
+    const qint64 grown = bench::residentBytes() - before;
+    qInfo() << "ports" << Nodes * PortsPerSide * 2
+            << "resident growth" << grown / 1024 << "KiB"
+            << "per port" << grown / (Nodes * PortsPerSide * 2) << "bytes (node share included)";
+
+    // No label keeps a hidden editor around.
+    QCOMPARE(QApplication::allWidgets().size(), widgets);
+}
+
+QTEST_MAIN(LabelEditorBench)
+#include "LabelEditorBench.moc"
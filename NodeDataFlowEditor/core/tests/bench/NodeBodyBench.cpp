@@ -0,0 +1,117 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "GeneratedScene.hpp"
+#include "core/view/NodeItemView.hpp"
+#include "core/view/NodeRenderCache.hpp"
+#include <QImage>
+#include <QPainter>
+#include <QtTest>
+
+using namespace nodeeditor::core;
+
+/**
+ * @brief Node body painting with and without NodeRenderCache, and a 20k-node pan.
+ */
+class NodeBodyBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void bodyPaint_data();
+    void bodyPaint();
+    void pan20k();
+};
+
+void
+NodeBodyBench::bodyPaint_data()
+{
+    QTest::addColumn<bool>("cached");
+    QTest::newRow("direct") << false;
+    QTest::newRow("cached") << true;
+}
+
+void
+NodeBodyBench::bodyPaint()
+{
+    QFETCH(bool, cached);
+
+    view::NodeItemView node(QStringLiteral("node"));
+    node.addInputRow(QStringLiteral("in"));
+    node.addOutputRow(QStringLiteral("out"));
+    view::FrameScheduler::instance().flush();
+
+    QImage target(320, 240, QImage::Format_ARGB32_Premultiplied);
+    target.fill(Qt::transparent);
+    QPainter painter(&target);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.translate(view::NodeRenderCache::Padding, view::NodeRenderCache::Padding);
+
+    const view::NodeBodyKey key = node.bodyKey(painter);
+    view::NodeRenderCache::instance().clear();
+
+    QBENCHMARK
+    {
+        if (cached)
+            node.paintBody(painter);
+        else
+            view::NodeItemView::drawBody(painter, key);
+    }
+}
+
+void
+NodeBodyBench::pan20k()
+{
+    NodeEditorScene scene;
+    const QRectF grid = bench::populate(scene, 20000);
+
+    view::GraphView graphView(&scene);
+    graphView.resize(1280, 800);
+    graphView.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&graphView));
+    graphView.centerOn(grid.topLeft() + QPointF(640., 400.));
+
+    auto& cache = view::NodeRenderCache::instance();
+    cache.clear();
+    cache.resetStats();
+    graphView.resetRepaintStats();
+
+    int frame = 0;
+    QBENCHMARK
+    {
+        bench::panFrame(graphView, bench::zigZag(frame++));
+    }
+
+    // Every node has the same size and colours: after the first frame, bodies are blits.
+    const auto stats = cache.stats();
+    const quint64 lookups = stats.hits + stats.misses;
+    QVERIFY(lookups > 0);
+    qInfo() << "frames" << graphView.repaintStats().frames
+            << "body cache hit rate" << 100.0 * stats.hits / lookups << "%"
+            << "entries" << stats.entries << "bytes" << stats.bytes;
+    QVERIFY(stats.hits > stats.misses);
+}
+
+QTEST_MAIN(NodeBodyBench)
+#include "NodeBodyBench.moc"
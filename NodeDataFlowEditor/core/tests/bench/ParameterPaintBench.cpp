@@ -0,0 +1,160 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/ParameterControl.hpp"
+#include <QCheckBox>
+#include <QElapsedTimer>
+#include <QGraphicsProxyWidget>
+#include <QGraphicsScene>
+#include <QImage>
+#include <QLineEdit>
+#include <QPainter>
+#include <QSpinBox>
+#include <QtTest>
+
+using namespace nodeeditor::core::view;
+
+namespace
+{
+    constexpr int Columns = 10;
+    constexpr int Parameters = 200;
+    constexpr int Frames = 20;
+
+    enum class Kind
+    {
+        Toggle,
+        Number,
+        Text
+    };
+
+    QGraphicsItem*
+    paintedControl(Kind kind)
+    {
+        switch (kind)
+        {
+            case Kind::Toggle:
+                return new ToggleParameterControl(true);
+            case Kind::Number:
+            {
+                auto* control = new NumberParameterControl(true);
+                control->setValue(42);
+                return control;
+            }
+            case Kind::Text:
+                return new TextParameterControl(QStringLiteral("parameter"));
+        }
+        return nullptr;
+    }
+
+    QGraphicsItem*
+    proxyWidget(Kind kind)
+    {
+        QWidget* widget = nullptr;
+        switch (kind)
+        {
+            case Kind::Toggle:
+            {
+                auto* box = new QCheckBox;
+                box->setChecked(true);
+                widget = box;
+                break;
+            }
+            case Kind::Number:
+            {
+                auto* spin = new QSpinBox;
+                spin->setValue(42);
+                widget = spin;
+                break;
+            }
+            case Kind::Text:
+                widget = new QLineEdit(QStringLiteral("parameter"));
+                break;
+        }
+        widget->resize(int(ParameterControl::DefaultWidth), int(ParameterControl::DefaultHeight));
+        auto* proxy = new QGraphicsProxyWidget;
+        proxy->setWidget(widget);
+        return proxy;
+    }
+} // namespace
+
+Q_DECLARE_METATYPE(Kind)
+
+/**
+ * @brief Paint cost per parameter: painted ParameterControl items against proxied QWidgets.
+ */
+class ParameterPaintBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void paint_data();
+    void paint();
+};
+
+void
+ParameterPaintBench::paint_data()
+{
+    QTest::addColumn<Kind>("kind");
+    QTest::addColumn<bool>("painted");
+    QTest::newRow("toggle, QCheckBox proxy") << Kind::Toggle << false;
+    QTest::newRow("toggle, painted") << Kind::Toggle << true;
+    QTest::newRow("number, QSpinBox proxy") << Kind::Number << false;
+    QTest::newRow("number, painted") << Kind::Number << true;
+    QTest::newRow("text, QLineEdit proxy") << Kind::Text << false;
+    QTest::newRow("text, painted") << Kind::Text << true;
+}
+
+void
+ParameterPaintBench::paint()
+{
+    QFETCH(Kind, kind);
+    QFETCH(bool, painted);
+
+    const qreal cellWidth = ParameterControl::DefaultWidth + 10.;
+    const qreal cellHeight = ParameterControl::DefaultHeight + 4.;
+
+    QGraphicsScene scene;
+    for (int i = 0; i < Parameters; ++i)
+    {
+        QGraphicsItem* item = painted ? paintedControl(kind) : proxyWidget(kind);
+        item->setPos((i % Columns) * cellWidth, (i / Columns) * cellHeight);
+        scene.addItem(item);
+    }
+
+    const QRectF area(0., 0., Columns * cellWidth, (Parameters / Columns) * cellHeight);
+    QImage target(area.size().toSize(), QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&target);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    // One warm-up frame, then report the mean cost of painting one parameter.
+    scene.render(&painter, area, area);
+    QElapsedTimer timer;
+    timer.start();
+    for (int frame = 0; frame < Frames; ++frame)
+        scene.render(&painter, area, area);
+    QTest::setBenchmarkResult(qreal(timer.nsecsElapsed()) / (Frames * Parameters), QTest::WalltimeNanoseconds);
+}
+
+QTEST_MAIN(ParameterPaintBench)
+#include "ParameterPaintBench.moc"
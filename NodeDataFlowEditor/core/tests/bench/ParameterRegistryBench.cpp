@@ -0,0 +1,140 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/ParameterControl.hpp"
+#include "core/view/ParameterTypeRegistry.hpp"
+#include <QtTest>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace nodeeditor::core::view;
+
+namespace
+{
+    constexpr int Parameters = 10000;
+
+    /** @brief Type names as they arrive from models, aliases included. */
+    const std::array<std::string, 6> TypeNames{"QString", "string", "bool", "int", "double", "float"};
+
+    /** @brief The string comparison chain the presenter used before the registry. */
+    ParameterControl*
+    createByChain(const std::string& type)
+    {
+        if (type == "QString" || type == "string")
+            return new TextParameterControl();
+        else if (type == "bool")
+            return new ToggleParameterControl();
+        else if (type == "int")
+            return new NumberParameterControl(true);
+        else if (type == "double" || type == "float")
+            return new NumberParameterControl(false);
+        return nullptr;
+    }
+
+    /** @brief Dispatch only: the branch the chain would take, without creating anything. */
+    int
+    dispatchByChain(const std::string& type)
+    {
+        if (type == "QString" || type == "string")
+            return 1;
+        else if (type == "bool")
+            return 2;
+        else if (type == "int")
+            return 3;
+        else if (type == "double" || type == "float")
+            return 4;
+        return 0;
+    }
+} // namespace
+
+/**
+ * @brief Creating 10k parameters through ParameterTypeRegistry against the old if-chain.
+ */
+class ParameterRegistryBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void dispatch_data();
+    void dispatch();
+    void create_data();
+    void create();
+};
+
+void
+ParameterRegistryBench::dispatch_data()
+{
+    QTest::addColumn<bool>("registry");
+    QTest::newRow("if-chain") << false;
+    QTest::newRow("registry") << true;
+}
+
+void
+ParameterRegistryBench::dispatch()
+{
+    QFETCH(bool, registry);
+    quint64 sum = 0;
+    QBENCHMARK
+    {
+        for (int i = 0; i < Parameters; ++i)
+        {
+            const std::string& type = TypeNames[i % TypeNames.size()];
+            sum += registry ? ParameterTypeRegistry::typeId(type) : dispatchByChain(type);
+        }
+    }
+    QVERIFY(sum > 0);
+}
+
+void
+ParameterRegistryBench::create_data()
+{
+    dispatch_data();
+}
+
+void
+ParameterRegistryBench::create()
+{
+    QFETCH(bool, registry);
+    std::vector<std::unique_ptr<ParameterControl>> controls;
+    controls.reserve(Parameters);
+
+    QBENCHMARK
+    {
+        controls.clear();
+        for (int i = 0; i < Parameters; ++i)
+        {
+            const std::string& type = TypeNames[i % TypeNames.size()];
+            controls.emplace_back(registry ? ParameterTypeRegistry::createControl(ParameterTypeRegistry::typeId(type))
+                                           : createByChain(type));
+        }
+    }
+    QCOMPARE(int(controls.size()), Parameters);
+    for (const auto& control : controls)
+        QVERIFY(control);
+}
+
+QTEST_MAIN(ParameterRegistryBench)
+#include "ParameterRegistryBench.moc"
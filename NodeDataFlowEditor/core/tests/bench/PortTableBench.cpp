@@ -0,0 +1,130 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "GeneratedScene.hpp"
+#include "core/view/NodeItemView.hpp"
+#include "core/view/PortTable.hpp"
+#include <QtTest>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace nodeeditor::core;
+
+namespace
+{
+    constexpr int Nodes = 2500;
+    constexpr int PortsPerSide = 10; ///< 2500 nodes * 20 ports = 50k ports.
+    constexpr int Ports = Nodes * PortsPerSide * 2;
+
+    using NodeList = std::vector<std::unique_ptr<view::NodeItemView>>;
+
+    /**
+     * @brief Build the nodes, with their ports as items or painted rows.
+     * @return Growth of the resident set.
+     */
+    qint64
+    build(NodeList& nodes, bool rows, int portsPerSide = PortsPerSide)
+    {
+        const qint64 before = bench::residentBytes();
+        for (int i = 0; i < Nodes; ++i)
+        {
+            auto node = std::make_unique<view::NodeItemView>(QStringLiteral("node%1").arg(i));
+            for (int p = 0; p < portsPerSide; ++p)
+            {
+                const QString in = QStringLiteral("in%1").arg(p);
+                const QString out = QStringLiteral("out%1").arg(p);
+                if (rows)
+                {
+                    node->addInputRow(in);
+                    node->addOutputRow(out);
+                }
+                else
+                {
+                    node->addInput(in);
+                    node->addOutput(out);
+                }
+            }
+            nodes.push_back(std::move(node));
+        }
+        view::FrameScheduler::instance().flush();
+        return bench::residentBytes() - before;
+    }
+} // namespace
+
+/**
+ * @brief Ports as PortItemView items against PortTable rows: construction time and memory.
+ */
+class PortTableBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void construct_data();
+    void construct();
+    void memoryPerPort();
+};
+
+void
+PortTableBench::construct_data()
+{
+    QTest::addColumn<bool>("rows");
+    QTest::newRow("PortItemView") << false;
+    QTest::newRow("PortTable") << true;
+}
+
+void
+PortTableBench::construct()
+{
+    QFETCH(bool, rows);
+    NodeList nodes;
+    nodes.reserve(Nodes);
+    QBENCHMARK_ONCE
+    {
+        build(nodes, rows);
+    }
+}
+
+void
+PortTableBench::memoryPerPort()
+{
+    if (bench::residentBytes() == 0)
+        QSKIP("Resident set size is not available on this platform");
+
+    // Everything stays alive, so no run reuses memory freed by another.
+    NodeList bareNodes;
+    NodeList rowNodes;
+    NodeList itemNodes;
+    const qint64 nodeBytes = build(bareNodes, true, 0);
+    const qint64 rowBytes = std::max<qint64>(build(rowNodes, true) - nodeBytes, 1);
+    const qint64 itemBytes = build(itemNodes, false) - nodeBytes;
+
+    qInfo() << "sizeof(PortTable::Row)" << sizeof(view::PortTable::Row)
+            << "per port: rows" << rowBytes / Ports << "bytes, items" << itemBytes / Ports << "bytes";
+
+    QVERIFY(itemBytes >= 10 * rowBytes);
+}
+
+QTEST_MAIN(PortTableBench)
+#include "PortTableBench.moc"
@@ -0,0 +1,112 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "GeneratedScene.hpp"
+#include "core/view/NodeRasterizer.hpp"
+#include "core/view/NodeRenderCache.hpp"
+#include <QtTest>
+#include <algorithm>
+#include <vector>
+
+using namespace nodeeditor::core;
+
+namespace
+{
+    constexpr int PanFrames = 300;
+    constexpr qint64 FrameBudgetNs = 16'666'667; ///< One frame at 60 Hz; slower frames count as hitches.
+} // namespace
+
+/**
+ * @brief Fast pans over bodies that are not cached yet, rasterized on the GUI thread or ahead of it.
+ */
+class RasterizerBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void cleanup();
+    void fastPan_data();
+    void fastPan();
+};
+
+void
+RasterizerBench::cleanup()
+{
+    view::NodeRasterizer::instance().setEnabled(false);
+    view::NodeRenderCache::instance().clear();
+}
+
+void
+RasterizerBench::fastPan_data()
+{
+    QTest::addColumn<bool>("async");
+    QTest::newRow("gui thread") << false;
+    QTest::newRow("workers") << true;
+}
+
+void
+RasterizerBench::fastPan()
+{
+    QFETCH(bool, async);
+
+    // Many title colours: every screenful brings bodies the cache has not seen.
+    NodeEditorScene scene;
+    const QRectF grid = bench::populate(scene, 20000, 2, 4096);
+
+    view::GraphView graphView(&scene);
+    graphView.resize(1280, 800);
+    graphView.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&graphView));
+    graphView.centerOn(grid.topLeft() + QPointF(640., 400.));
+
+    auto& rasterizer = view::NodeRasterizer::instance();
+    rasterizer.setEnabled(async);
+    rasterizer.resetStats();
+    view::NodeRenderCache::instance().clear();
+    graphView.resetRepaintStats();
+
+    std::vector<qint64> frames;
+    frames.reserve(PanFrames);
+    QElapsedTimer wall;
+    wall.start();
+    QBENCHMARK_ONCE
+    {
+        for (int frame = 0; frame < PanFrames; ++frame)
+            frames.push_back(bench::panFrame(graphView, bench::zigZag(frame, QPoint(160, 80), 100)));
+    }
+    const qreal seconds = wall.nsecsElapsed() / 1e9;
+
+    const auto hitches = std::count_if(frames.begin(), frames.end(), [](qint64 ns) { return ns > FrameBudgetNs; });
+    const auto stats = rasterizer.stats();
+    qInfo() << "hitches" << hitches << "of" << frames.size() << "frames"
+            << "worst" << *std::max_element(frames.begin(), frames.end()) / 1e6 << "ms"
+            << "placeholders/s" << stats.placeholders / seconds
+            << "rasterized" << stats.completed << "of" << stats.submitted;
+
+    if (!async)
+        QCOMPARE(stats.placeholders, quint64(0));
+}
+
+QTEST_MAIN(RasterizerBench)
+#include "RasterizerBench.moc"
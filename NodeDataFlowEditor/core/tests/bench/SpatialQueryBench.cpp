@@ -0,0 +1,160 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/SpatialGrid.hpp"
+#include <QGraphicsRectItem>
+#include <QGraphicsScene>
+#include <QRandomGenerator>
+#include <QtTest>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace nodeeditor::core::view;
+
+namespace
+{
+    constexpr int Items = 100000;
+    constexpr qreal Extent = 60000.; ///< Roughly a node per 190 x 190 scene units.
+    constexpr int Queries = 256;
+
+    /** @brief The same 100k rects in a QGraphicsScene (BSP index) and in a SpatialGrid. */
+    struct Scenes
+    {
+        QGraphicsScene scene;
+        SpatialGrid<QGraphicsItem*> grid{512.0};
+        std::vector<QRectF> probes;
+
+        Scenes()
+        {
+            QRandomGenerator random(100000);
+            scene.setSceneRect(0., 0., Extent, Extent);
+            for (int i = 0; i < Items; ++i)
+            {
+                auto* item = scene.addRect(0., 0., 80. + random.bounded(120.), 60. + random.bounded(200.));
+                item->setPos(random.bounded(Extent), random.bounded(Extent));
+                grid.insert(item, item->sceneBoundingRect());
+            }
+            // Build the BSP tree now rather than inside the first measured query.
+            scene.items(QRectF(0., 0., 1., 1.));
+        }
+
+        /** @brief Query rects of @p size at fixed random spots. */
+        void
+        makeProbes(const QSizeF& size)
+        {
+            QRandomGenerator random(Queries);
+            probes.clear();
+            for (int i = 0; i < Queries; ++i)
+                probes.emplace_back(QPointF(random.bounded(Extent), random.bounded(Extent)), size);
+        }
+    };
+} // namespace
+
+/**
+ * @brief Rect queries over 100k items: QGraphicsScene::items(rect) against SpatialGrid.
+ */
+class SpatialQueryBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void sameResults();
+    void query_data();
+    void query();
+
+private:
+    std::unique_ptr<Scenes> m_scenes;
+};
+
+void
+SpatialQueryBench::initTestCase()
+{
+    m_scenes = std::make_unique<Scenes>();
+}
+
+void
+SpatialQueryBench::cleanupTestCase()
+{
+    m_scenes.reset();
+}
+
+void
+SpatialQueryBench::sameResults()
+{
+    auto& s = *m_scenes;
+    s.makeProbes(QSizeF(1920., 1080.));
+    for (const QRectF& probe : s.probes)
+    {
+        QList<QGraphicsItem*> expected = s.scene.items(probe, Qt::IntersectsItemBoundingRect);
+        std::vector<QGraphicsItem*> actual;
+        s.grid.query(probe, [&actual](QGraphicsItem* const& item, const QRectF&) { actual.push_back(item); });
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        QCOMPARE(int(actual.size()), int(expected.size()));
+        QVERIFY(std::equal(actual.begin(), actual.end(), expected.begin()));
+    }
+}
+
+void
+SpatialQueryBench::query_data()
+{
+    QTest::addColumn<QSizeF>("size");
+    QTest::addColumn<bool>("grid");
+    QTest::newRow("viewport, QGraphicsScene") << QSizeF(1920., 1080.) << false;
+    QTest::newRow("viewport, SpatialGrid") << QSizeF(1920., 1080.) << true;
+    QTest::newRow("zoomed out, QGraphicsScene") << QSizeF(9600., 5400.) << false;
+    QTest::newRow("zoomed out, SpatialGrid") << QSizeF(9600., 5400.) << true;
+    QTest::newRow("pick, QGraphicsScene") << QSizeF(8., 8.) << false;
+    QTest::newRow("pick, SpatialGrid") << QSizeF(8., 8.) << true;
+}
+
+void
+SpatialQueryBench::query()
+{
+    QFETCH(QSizeF, size);
+    QFETCH(bool, grid);
+
+    auto& s = *m_scenes;
+    s.makeProbes(size);
+
+    qint64 found = 0;
+    QBENCHMARK
+    {
+        for (const QRectF& probe : s.probes)
+        {
+            if (grid)
+                s.grid.query(probe, [&found](QGraphicsItem* const&, const QRectF&) { ++found; });
+            else
+                found += s.scene.items(probe, Qt::IntersectsItemBoundingRect).size();
+        }
+    }
+    QVERIFY(found > 0);
+}
+
+QTEST_MAIN(SpatialQueryBench)
+#include "SpatialQueryBench.moc"
@@ -0,0 +1,152 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/EditableArrowItemView.hpp"
+#include "core/view/TextLayoutCache.hpp"
+#include <QImage>
+#include <QPainter>
+#include <QTextDocument>
+#include <QtTest>
+#include <memory>
+#include <vector>
+
+using namespace nodeeditor::core::view;
+
+namespace
+{
+    constexpr int Labels = 1000;
+    constexpr int DistinctTexts = 16; ///< Port names repeat a lot across a graph.
+
+    QString
+    labelText(int i)
+    {
+        return QStringLiteral("input%1").arg(i % DistinctTexts);
+    }
+} // namespace
+
+/**
+ * @brief Port label layout and painting: a QTextDocument per label against shared TextLayoutCache layouts.
+ */
+class TextLayoutBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void layout_data();
+    void layout();
+    void paint_data();
+    void paint();
+};
+
+void
+TextLayoutBench::layout_data()
+{
+    QTest::addColumn<bool>("cached");
+    QTest::newRow("QTextDocument") << false;
+    QTest::newRow("TextLayoutCache") << true;
+}
+
+void
+TextLayoutBench::layout()
+{
+    QFETCH(bool, cached);
+    const QFont& font = EditableArrowItemView::labelFont();
+    auto& cache = TextLayoutCache::instance();
+    cache.clear();
+
+    qreal width = 0.;
+    QBENCHMARK
+    {
+        for (int i = 0; i < Labels; ++i)
+        {
+            if (cached)
+            {
+                width += cache.layout(labelText(i), font).size.width();
+            }
+            else
+            {
+                QTextDocument document;
+                document.setDefaultFont(font);
+                document.setPlainText(labelText(i));
+                width += document.size().width();
+            }
+        }
+    }
+    QVERIFY(width > 0.);
+}
+
+void
+TextLayoutBench::paint_data()
+{
+    layout_data();
+}
+
+void
+TextLayoutBench::paint()
+{
+    QFETCH(bool, cached);
+    const QFont& font = EditableArrowItemView::labelFont();
+
+    // Laid out up front: this measures drawing only.
+    std::vector<std::unique_ptr<QTextDocument>> documents;
+    std::vector<TextLayoutCache::Layout> layouts;
+    for (int i = 0; i < Labels; ++i)
+    {
+        if (cached)
+        {
+            layouts.push_back(TextLayoutCache::instance().layout(labelText(i), font));
+            continue;
+        }
+        auto document = std::make_unique<QTextDocument>();
+        document->setDefaultFont(font);
+        document->setPlainText(labelText(i));
+        documents.push_back(std::move(document));
+    }
+
+    QImage target(1024, 1024, QImage::Format_ARGB32_Premultiplied);
+    target.fill(Qt::black);
+    QPainter painter(&target);
+
+    QBENCHMARK
+    {
+        for (int i = 0; i < Labels; ++i)
+        {
+            const QPointF topLeft((i % 8) * 128., (i / 8) * 8.);
+            if (cached)
+            {
+                TextLayoutCache::draw(painter, topLeft, layouts[i]);
+            }
+            else
+            {
+                painter.save();
+                painter.translate(topLeft);
+                documents[i]->drawContents(&painter);
+                painter.restore();
+            }
+        }
+    }
+}
+
+QTEST_MAIN(TextLayoutBench)
+#include "TextLayoutBench.moc"
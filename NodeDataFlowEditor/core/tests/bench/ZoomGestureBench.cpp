@@ -0,0 +1,126 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "GeneratedScene.hpp"
+#include "core/view/NodeRasterizer.hpp"
+#include "core/view/NodeRenderCache.hpp"
+#include <QtTest>
+#include <algorithm>
+#include <vector>
+
+using namespace nodeeditor::core;
+
+namespace
+{
+    constexpr int ZoomFrames = 240;
+    constexpr int LegNotches = 12; ///< Wheel notches per leg: 1.15^12 is about 5x, inside the zoom range.
+    constexpr int SettleMs = 150;
+    constexpr qint64 FrameBudgetNs = 16'666'667; ///< One frame at 60 Hz; slower frames count as hitches.
+} // namespace
+
+/**
+ * @brief Wheel zoom gestures over 100k nodes, drawn from the scene or from a scaled snapshot.
+ */
+class ZoomGestureBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void cleanup();
+    void wheelZoom_data();
+    void wheelZoom();
+};
+
+void
+ZoomGestureBench::cleanup()
+{
+    view::NodeRasterizer::instance().setEnabled(false);
+    view::NodeRenderCache::instance().clear();
+}
+
+void
+ZoomGestureBench::wheelZoom_data()
+{
+    QTest::addColumn<bool>("snapshot");
+    QTest::newRow("scene") << false;
+    QTest::newRow("snapshot") << true;
+}
+
+void
+ZoomGestureBench::wheelZoom()
+{
+    QFETCH(bool, snapshot);
+
+    NodeEditorScene scene;
+    const QRectF grid = bench::populate(scene, 100000, 1, 4096);
+
+    view::GraphView graphView(&scene);
+    graphView.resize(1280, 800);
+    graphView.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&graphView));
+    graphView.centerOn(grid.center());
+    graphView.setZoomSnapshotEnabled(snapshot, SettleMs);
+
+    auto& rasterizer = view::NodeRasterizer::instance();
+    rasterizer.setEnabled(true);
+    rasterizer.resetStats();
+    view::NodeRenderCache::instance().clear();
+    graphView.resetRepaintStats();
+
+    // Out a leg, back in a leg, and so on, without pausing long enough to settle.
+    std::vector<qint64> frames;
+    frames.reserve(ZoomFrames);
+    QElapsedTimer wall;
+    wall.start();
+    QBENCHMARK_ONCE
+    {
+        for (int frame = 0; frame < ZoomFrames; ++frame)
+            frames.push_back(bench::zoomFrame(graphView, (frame / LegNotches) % 2 ? 1 : -1));
+    }
+    const qreal seconds = wall.nsecsElapsed() / 1e9;
+
+    const auto hitches = std::count_if(frames.begin(), frames.end(), [](qint64 ns) { return ns > FrameBudgetNs; });
+    const auto& repaint = graphView.repaintStats();
+    const auto stats = rasterizer.stats();
+    qInfo() << "hitches" << hitches << "of" << frames.size() << "frames"
+            << "worst" << *std::max_element(frames.begin(), frames.end()) / 1e6 << "ms"
+            << "snapshot frames/s" << repaint.snapshotFrames / seconds
+            << "placeholders/s" << stats.placeholders / seconds;
+
+    if (!snapshot)
+    {
+        QCOMPARE(repaint.snapshotFrames, quint64(0));
+        return;
+    }
+    QVERIFY(repaint.snapshotFrames > 0);
+
+    // Once the wheel stops, the gesture settles back to drawing the scene.
+    QTRY_VERIFY_WITH_TIMEOUT(!graphView.isZoomGestureActive(), SettleMs * 10);
+    const quint64 before = graphView.repaintStats().snapshotFrames;
+    graphView.viewport()->repaint();
+    QCOMPARE(graphView.repaintStats().snapshotFrames, before);
+}
+
+QTEST_MAIN(ZoomGestureBench)
+#include "ZoomGestureBench.moc"
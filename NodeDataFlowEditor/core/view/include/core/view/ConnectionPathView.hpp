@@ -26,8 +26,10 @@
 
 #include "common/utility/ConnectionInfo.hpp"
 #include "common/view/AbstractPathView.hpp"
+#include "core/view/EdgeGeometryBatch.hpp"
 #include "mvp/utility/Signal.hpp"
 #include <QTimer>
+#include <optional>
 
 namespace nodeeditor::core::view
 {
@@ -57,6 +59,15 @@ namespace nodeeditor::core::view
          */
         ~ConnectionPathView();
 
+        /** @name Pooling (see ViewPool) */
+        ///@{
+        /** @brief Stop the animation and drop every connection before the view is pooled. */
+        void recycle();
+        /** @brief Re-initialize a pooled view as if freshly constructed. */
+        void resetForReuse(const ConnectionPortData& port, QGraphicsItem* parent = nullptr);
+        void resetForReuse(const ConnectionPortData& port1, const ConnectionPortData& port2, QGraphicsItem* parent = nullptr);
+        ///@}
+
         /**
          * @brief add an input or output endpoint.
          * @param isInput True if setting the input side; false for output.
@@ -102,6 +113,22 @@ namespace nodeeditor::core::view
          */
         void updatePath();
 
+        /**
+         * @brief The two points the curve runs between, as @ref updatePath would pick them.
+         * @return false while the connection has nothing to draw.
+         */
+        bool curveEnds(QPointF* start, QPointF* end) const;
+
+        /**
+         * @brief Install a curve computed elsewhere, typically by EdgeGeometryBatch.
+         *
+         * Same effect as @ref updatePath for the curve's end points.
+         */
+        void applyCurve(const EdgeCurve& curve);
+
+        /** @brief Control points, bounds and polyline of the current curve. */
+        const EdgeCurve& curve() const;
+
         /**
          * @brief Mark the connection as compatible or incompatible with its target.
          *
@@ -116,6 +143,18 @@ namespace nodeeditor::core::view
          */
         bool isDestroying() const;
         QPainterPath shape() const override;
+
+        /** @brief Curve bounds padded for the selection glow; no stroking involved. */
+        QRectF boundingRect() const override;
+
+        /**
+         * @brief The current connection curve, in item coordinates.
+         */
+        const QPainterPath& currentPath() const;
+
+        /** @brief Emitted after the curve or its pen changed. */
+        base::mvp::utility::Signal<> path_changed;
+
         // -------------------- Signals & Setters --------------------
         base::mvp::utility::Signal<const common::utility::SPort&> inputPort_changed;
         void set_inputPort(const common::utility::SPort& p);
@@ -123,6 +162,29 @@ namespace nodeeditor::core::view
         void set_inputPos(const common::utility::SPos& p);
         void set_outputPos(const common::utility::SPos& p);
 
+        /**
+         * @brief Shift both endpoints at once and rebuild the curve a single time.
+         *
+         * Used when a whole node moves: its ports keep their local offsets, so
+         * every attached endpoint moves by the same scene delta.
+         */
+        void translateEnds(const QPointF& inputDelta, const QPointF& outputDelta);
+
+        /**
+         * @brief Shift the endpoints like @ref translateEnds but leave the curve as is.
+         *
+         * The caller rebuilds it, usually by queueing the edge on EdgeGeometryBatch.
+         */
+        void shiftEnds(const QPointF& inputDelta, const QPointF& outputDelta);
+
+        /**
+         * @brief Shift the whole connection by @p delta without rebuilding the curve.
+         *
+         * For edges whose two nodes move together: the shape is unchanged, so the
+         * cached path is translated as is.
+         */
+        void translateRigidly(const QPointF& delta);
+
         base::mvp::utility::Signal<const common::utility::SPort&> outputPort_changed;
         void set_outputPort(const common::utility::SPort& p);
 
@@ -176,12 +238,18 @@ namespace nodeeditor::core::view
         ConnectionPortData m_outputPort; ///< Data for output connection port.
 
         QPointF m_endPoint; ///< Current end point of the connection.
+        EdgeCurve m_curve;  ///< Geometry behind @ref m_currentPath.
 
         QTimer m_animationTimer;           ///< Timer used for animating active connections.
         QVector<double> m_circlePositions; ///< Animation positions for decorative elements (e.g. flowing dots).
 
         bool m_isDestroying = false; ///< Flag set during cleanup to prevent further updates.
 
+        /** @brief Follow RenderQuality::level_changed, which pauses and resumes the flow animation. */
+        void watchQuality();
+        void unwatchQuality();
+        std::optional<std::size_t> m_qualitySlot; ///< Connection on RenderQuality::level_changed.
+
         bool active_{false};
         bool compatible_{false};
 
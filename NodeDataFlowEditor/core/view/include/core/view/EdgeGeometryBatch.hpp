@@ -0,0 +1,127 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QPainterPath>
+#include <QPolygonF>
+#include <QRectF>
+#include <QThreadPool>
+#include <unordered_map>
+#include <vector>
+
+namespace nodeeditor::core::view
+{
+    class ConnectionPathView;
+
+    /** @brief Everything derived from a connection's two end points. */
+    struct EdgeCurve
+    {
+        QPointF start;
+        QPointF ctrl1;
+        QPointF ctrl2;
+        QPointF end;
+        QRectF bounds;      ///< Exact bounds of the curve, without stroke.
+        QPolygonF polyline; ///< The curve flattened into EdgeGeometryBatch::Segments segments.
+        QPainterPath path;
+    };
+
+    /**
+     * @brief Rebuilds many connection curves at once, off the GUI thread.
+     *
+     * Dirty edges are queued with @ref enqueue. @ref flush reads their end
+     * points into flat per-coordinate arrays, evaluates control points, bounds
+     * and polylines in chunks on a worker pool (two curves per SSE2 step where
+     * available), then hands each result to its ConnectionPathView on the GUI
+     * thread. Small batches stay on the calling thread.
+     */
+    class EdgeGeometryBatch
+    {
+    public:
+        /** @brief Segments per flattened curve. */
+        static constexpr int Segments = 16;
+
+        struct Stats
+        {
+            quint64 flushes = 0;
+            quint64 curves = 0;     ///< Curves rebuilt over all flushes.
+            qint64 lastFlushNs = 0; ///< Wall time of the last flush, apply included.
+            int lastChunks = 0;     ///< Chunks the last flush was split into.
+        };
+
+        static EdgeGeometryBatch& instance();
+
+        /** @brief Maximum number of worker threads. */
+        void setMaxThreadCount(int count);
+
+        /** @brief Batches smaller than this are evaluated on the calling thread. */
+        void setParallelThreshold(std::size_t edges);
+        std::size_t parallelThreshold() const;
+
+        /** @brief Queue @p edge; its end points are read at @ref flush time. */
+        void enqueue(ConnectionPathView* edge);
+
+        /** @brief Drop @p edge from the queue, e.g. before it is destroyed. */
+        void cancel(ConnectionPathView* edge);
+
+        std::size_t pendingCount() const;
+
+        /** @brief Rebuild every queued curve and apply the results. Blocks until done. */
+        void flush();
+
+        /**
+         * @brief Flush once on the next FrameScheduler turn.
+         *
+         * Moves spread over many calls in one turn (auto-layout, programmatic
+         * moves) then form one batch, and an edge between two moved nodes is
+         * rebuilt once.
+         */
+        void scheduleFlush();
+
+        /** @brief The curve between two points, evaluated on the calling thread. */
+        static EdgeCurve curveFor(const QPointF& start, const QPointF& end);
+
+        Stats stats() const;
+        void resetStats();
+
+    private:
+        friend class CurveJob;
+
+        /** @brief End points of a batch, one array per coordinate. */
+        struct Points
+        {
+            std::vector<double> x0, y0, x1, y1;
+        };
+
+        EdgeGeometryBatch();
+
+        static void evaluate(const Points& points, std::size_t begin, std::size_t end, EdgeCurve* out);
+
+        QThreadPool m_pool;
+        std::size_t m_parallelThreshold = 2048;
+        std::vector<ConnectionPathView*> m_queue; ///< Cancelled entries are null.
+        std::unordered_map<ConnectionPathView*, std::size_t> m_queued;
+        Stats m_stats;
+    };
+} // namespace nodeeditor::core::view
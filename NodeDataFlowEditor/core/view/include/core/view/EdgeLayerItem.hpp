@@ -0,0 +1,161 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "core/view/SpatialGrid.hpp"
+#include <QGraphicsItem>
+#include <QPainterPath>
+#include <QPen>
+#include <QVector>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace nodeeditor::core::view
+{
+    class ConnectionPathView;
+
+    /**
+     * @brief Draws many connections in a single paint pass.
+     *
+     * Connections handed to the layer are expected to be out of the scene, so they
+     * cost neither a BSP entry nor a paint dispatch of their own. The layer groups
+     * their curves by pen and caches, per scene tile, one combined path per pen.
+     * A tile is rebuilt only when an edge crossing it changes.
+     *
+     * Picking goes through an internal SpatialGrid over edge bounds, see @ref edgeAt.
+     * Promoting an edge back to an individual item (for selection, editing or
+     * animation) is the owner's job: remove it here, then add it to the scene.
+     */
+    class EdgeLayerItem : public QGraphicsItem
+    {
+    public:
+        /**
+         * @brief Construct an empty layer.
+         * @param tileSize Edge length of one cache tile in scene units.
+         * @param parent Optional parent graphics item.
+         */
+        explicit EdgeLayerItem(qreal tileSize = 512.0, QGraphicsItem* parent = nullptr);
+        ~EdgeLayerItem() override;
+
+        /**
+         * @brief Start drawing a connection as part of the layer.
+         *
+         * The layer follows the connection's path_changed signal until removed.
+         */
+        void addEdge(ConnectionPathView* edge);
+
+        /** @brief Stop drawing a connection. Does nothing if not in the layer. */
+        void removeEdge(ConnectionPathView* edge);
+
+        /** @brief Remove all connections from the layer. */
+        void clear();
+
+        /** @brief Check whether a connection is drawn by the layer. */
+        bool containsEdge(ConnectionPathView* edge) const;
+
+        /** @brief Number of connections drawn by the layer. */
+        std::size_t edgeCount() const;
+
+        /**
+         * @brief Find the batched connection closest to a scene point.
+         * @param scenePos Point in scene coordinates.
+         * @param radius Maximum distance from the curve.
+         * @return The hit connection, or nullptr.
+         */
+        ConnectionPathView* edgeAt(const QPointF& scenePos, qreal radius = 5.0) const;
+
+        /**
+         * @brief Re-read the geometry and pen of a connection.
+         *
+         * Called automatically on path_changed; exposed for pen-only changes.
+         */
+        void refreshEdge(ConnectionPathView* edge);
+
+        QRectF boundingRect() const override;
+
+        /** @brief Empty: the layer is never hit by itemAt(), use @ref edgeAt instead. */
+        QPainterPath shape() const override;
+
+        void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
+
+    private:
+        using TileKey = quint64;
+        /** @brief Everything of a pen the layer draws with; caps and joins are always round. */
+        struct PenKey
+        {
+            QRgb color = 0;
+            int width = 0; ///< In 1/100 units.
+            Qt::PenStyle style = Qt::SolidLine;
+            QVector<qreal> dashes; ///< Custom dash pattern, for Qt::CustomDashLine only.
+            qreal dashOffset = 0.;
+
+            bool operator<(const PenKey& other) const
+            {
+                return std::tie(color, width, style, dashes, dashOffset) <
+                       std::tie(other.color, other.width, other.style, other.dashes, other.dashOffset);
+            }
+        };
+
+        struct EdgeEntry
+        {
+            QRectF bounds;
+            std::vector<TileKey> tiles;
+            PenKey pen;
+            std::size_t pathSlot = 0; ///< Signal connection id on ConnectionPathView::path_changed.
+        };
+
+        struct Tile
+        {
+            std::unordered_set<ConnectionPathView*> edges;
+            std::map<PenKey, QPainterPath> paths; ///< Cached combined curve per pen.
+            bool dirty = true;
+        };
+
+        static PenKey penKey(const QPen& pen);
+        static QPen penFor(const PenKey& key);
+
+        TileKey tileKey(int tx, int ty) const;
+        QRectF tileRect(TileKey key) const;
+        std::vector<TileKey> tilesFor(const QRectF& bounds) const;
+
+        void attachTiles(ConnectionPathView* edge, EdgeEntry& entry);
+        void detachTiles(ConnectionPathView* edge, EdgeEntry& entry);
+        void rebuildTile(Tile& tile) const;
+        void growBounds(const QRectF& r);
+        /** @brief Shrink the bounds to the remaining edges on the next frame, if @p r touched their border. */
+        void scheduleShrink(const QRectF& r);
+        void recomputeBounds();
+
+    private:
+        qreal m_tileSize;
+        QRectF m_bounds;
+
+        std::unordered_map<ConnectionPathView*, EdgeEntry> m_edges;
+        mutable std::unordered_map<TileKey, Tile> m_tiles;
+        SpatialGrid<ConnectionPathView*> m_pickIndex;
+    };
+} // namespace nodeeditor::core::view
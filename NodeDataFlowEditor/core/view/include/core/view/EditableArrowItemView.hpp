@@ -1,10 +1,11 @@
 #pragma once
 
 #include "common/view/AbstractItemView.hpp"
+#include "core/view/TextLayoutCache.hpp"
+#include <QPolygonF>
 
 class QLineEdit;
 class QGraphicsProxyWidget;
-class QGraphicsTextItem;
 
 namespace nodeeditor::core::view
 {
@@ -30,24 +31,44 @@ namespace nodeeditor::core::view
         void paint(QPainter* painter, const QStyleOptionGraphicsItem*, QWidget*) override;
 
         // Editing
+        /** @brief Creates the inline editor on demand and gives it focus. */
         void startEditing();
+        /** @brief Commits the edited text and destroys the inline editor. */
         void finishEditing();
+        /** @brief True while the inline editor exists. */
+        bool isEditing() const;
 
         void setShowArrow(bool newShowArrow);
 
+        /** @brief Let RenderQuality hide the text at its NoPortLabels level; the arrow stays. */
+        void setLabelDroppable(bool droppable);
+
+        /** @brief Font used for every label; shared with painted port rows. */
+        static const QFont& labelFont();
+
+        /** @brief Arrow glyph for a label of the given text size, in label coordinates. */
+        static QPolygonF arrowPolygon(bool arrowBeforeLabel, qreal textWidth, qreal textHeight);
+
+        static constexpr qreal ArrowWidth = 10.0;
+        static constexpr qreal ArrowSpacing = 4.0;
+
     private:
         std::function<void(const QString&)> onTextChanged;
 
         void repositionElements();
+        QPointF labelPos() const;
 
     private:
         bool arrowBeforeLabel_{true};
         bool editable_{true};
         bool showArrow_{true};
+        bool labelDroppable_{false};
 
-        QGraphicsTextItem* labelItem_;
-        QLineEdit* editWidget_;
-        QGraphicsProxyWidget* editProxy_;
+        // Shaped once per (text, font) in TextLayoutCache and shared across labels.
+        TextLayoutCache::Layout layout_;
+        // Only alive while editing; a hidden QWidget per label is too costly on large graphs.
+        QLineEdit* editWidget_{nullptr};
+        QGraphicsProxyWidget* editProxy_{nullptr};
 
         // Internal storage for properties
         std::string text_;
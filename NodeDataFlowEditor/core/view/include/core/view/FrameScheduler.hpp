@@ -0,0 +1,68 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Runs deferred work once per event-loop turn, coalesced by key.
+     *
+     * Posting twice with the same key before the next turn keeps a single
+     * task (the latest one) at its original position, so bursts of change
+     * notifications collapse into one pass per frame.
+     */
+    class FrameScheduler : public QObject
+    {
+    public:
+        using Task = std::function<void()>;
+
+        static FrameScheduler& instance();
+
+        /** @brief Schedule @p task for the next turn, replacing any task already posted for @p key. */
+        void post(const void* key, Task task);
+
+        /** @brief Drop the task posted for @p key, e.g. before the owner is destroyed. */
+        void cancel(const void* key);
+
+        /** @brief True if a task is waiting for @p key. */
+        bool isPending(const void* key) const;
+
+        /** @brief Run every pending task now. Tasks posted meanwhile run in the same call. */
+        void flush();
+
+    private:
+        FrameScheduler();
+
+        QTimer m_timer;
+        std::vector<std::pair<const void*, Task>> m_tasks;
+        std::unordered_map<const void*, std::size_t> m_index;
+    };
+} // namespace nodeeditor::core::view
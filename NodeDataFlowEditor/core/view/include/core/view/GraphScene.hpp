@@ -1,14 +1,39 @@
 #pragma once
+#include "core/view/SelectionSet.hpp"
+#include "core/view/SpatialGrid.hpp"
+#include "core/view/SpatialIndex.hpp"
+#include "mvp/utility/Signal.hpp"
+#include <QElapsedTimer>
 #include <QGraphicsScene>
+#include <QVariant>
+#include <QVector>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+class QGraphicsPixmapItem;
+
+namespace nodeeditor::core::model
+{
+    struct ConnectionPathModel;
+    struct NodeItemModel;
+} // namespace nodeeditor::core::model
 namespace nodeeditor::core::presenter
 {
     class ConnectionPathPresenter;
     class PortItemPresenter;
     class NodeItemPresenter;
 } // namespace nodeeditor::core::presenter
+namespace nodeeditor::core::view
+{
+    class ConnectionPathView;
+    class EdgeLayerItem;
+    class NodeItemView;
+    class PortItemView;
+} // namespace nodeeditor::core::view
 namespace nodeeditor
 {
     namespace core
@@ -20,6 +45,7 @@ namespace nodeeditor
 
         public:
             explicit NodeEditorScene(QObject* parent = nullptr);
+            ~NodeEditorScene() override;
 
             std::shared_ptr<presenter::NodeItemPresenter> createNode(
                 const QString& name,
@@ -37,8 +63,12 @@ namespace nodeeditor
             bool removeNode(const QString& nodeId);
             bool removeConnection(std::shared_ptr<presenter::ConnectionPathPresenter> connectionId);
 
+            /** @brief Materialized nodes only; see @ref setVirtualizationEnabled. */
             const std::unordered_map<QString, std::shared_ptr<nodeeditor::core::presenter::NodeItemPresenter>>& nodes() const;
 
+            /** @brief Number of nodes, parked ones included. */
+            std::size_t nodeCount() const;
+
             const std::vector<std::shared_ptr<nodeeditor::core::presenter::ConnectionPathPresenter>>& connections() const;
 
             std::shared_ptr<presenter::PortItemPresenter> addInputPort(
@@ -51,16 +81,376 @@ namespace nodeeditor
                 const QString& portName,
                 const QString& displayName);
 
+            /**
+             * @brief Add a painted input row to a node (no per-port item, presenter or model).
+             * @return false if the node is unknown or the name is taken.
+             */
+            bool addInputRow(const QString& nodeId, const QString& portName, const QString& displayName = QString());
+
+            /** @brief Output counterpart of @ref addInputRow. */
+            bool addOutputRow(const QString& nodeId, const QString& portName, const QString& displayName = QString());
+
+            /**
+             * @brief Set the compatibility tags of a port or painted row, on either side.
+             *
+             * While dragging a new connection from a port, only ports sharing a tag
+             * with it (or untagged ones) are offered for snapping.
+             * @return false if the node or port is unknown.
+             */
+            bool setPortTags(const QString& nodeId, const QString& portName, const common::taggable::TagBitMask& tags);
+
         public:
             bool removePort(
                 const QString& nodeId,
                 const QString& portName);
 
+            /**
+             * @brief Draw idle connections through a single EdgeLayerItem.
+             *
+             * When enabled, every connection that is neither selected nor active is
+             * taken out of the scene and painted by the layer. Clicking a batched
+             * connection promotes it back to an individual item; it returns to the
+             * layer once deselected and inactive.
+             */
+            void setEdgeBatchingEnabled(bool enabled);
+            bool edgeBatchingEnabled() const;
+            view::EdgeLayerItem* edgeLayer() const;
+
+            /**
+             * @brief Cache mode given to every node item, current and future.
+             *
+             * Set by GraphView's adaptive strategy; DeviceCoordinateCache pays off
+             * while the view only pans.
+             */
+            void setNodeCacheMode(QGraphicsItem::CacheMode mode);
+            QGraphicsItem::CacheMode nodeCacheMode() const;
+
+            /** @brief Drop the cached pixmaps of every live node, on screen or not, e.g. after a quality change. */
+            void invalidateNodeCaches();
+
+            /**
+             * @brief Queue node bodies just outside the viewport for background rasterization.
+             * @param visibleRect Scene rect currently shown by the view.
+             * @param panDelta Scene-space movement of the viewport since the previous frame.
+             * @param pixelRatio Device pixel ratio times the view scale.
+             *
+             * The look-ahead region extends the visible rect in the pan direction.
+             * No-op unless NodeRasterizer is enabled.
+             */
+            void prefetchAround(const QRectF& visibleRect, const QPointF& panDelta, qreal pixelRatio);
+
+            /**
+             * @brief Keep view items only for nodes around the viewport.
+             * @param margin Scene-space distance around the viewport within which nodes stay materialized.
+             *
+             * A parked node has no view, presenter or ports; it is kept as its model,
+             * its scene bounds and a description of its rows, item ports and painted
+             * parameters. Its edges stay in the scene. It is rebuilt when the viewport
+             * comes near it or when a scene method names it. Nodes that are selected,
+             * that have a live row port, or whose parameter controls are unregistered
+             * or being edited are never parked. Presenters returned by @ref createNode
+             * and its port presenters are only live while their node is materialized.
+             * Disabling materializes every node.
+             */
+            void setVirtualizationEnabled(bool enabled, qreal margin = 512.0);
+            bool virtualizationEnabled() const;
+
+            /**
+             * @brief Report the scene rect shown by the view.
+             *
+             * Materializes parked nodes entering the margin around @p visibleRect
+             * and parks materialized nodes that left it. No-op unless virtualized.
+             */
+            void updateViewport(const QRectF& visibleRect);
+
+            bool isNodeMaterialized(const QString& nodeId) const;
+
+            /** @brief Rebuild a parked node now; returns its presenter, or nullptr if unknown. */
+            std::shared_ptr<presenter::NodeItemPresenter> materializeNode(const QString& nodeId);
+
+            /**
+             * @brief Typed spatial index over materialized nodes, their ports and all edges.
+             *
+             * Kept current incrementally on node moves, re-layouts and edge path changes.
+             */
+            const view::SpatialIndex& spatialIndex() const;
+
+            /**
+             * @name Batch selection
+             * Node and edge selection lives in a SelectionSet over dense indices.
+             * These calls update it in one pass, mirror it onto the items without
+             * their per-item select_changed cascade (models are not told), and
+             * report the outcome once through @ref selection_changed. Ports keep
+             * Qt's own selection. Parked nodes are never selected.
+             */
+            ///@{
+            /**
+             * @brief Select the nodes intersecting @p rect and the edges inside it.
+             * @param extend Keep the current selection instead of replacing it.
+             */
+            void selectRect(const QRectF& rect, bool extend = false);
+            void selectAll();
+            void invertSelection();
+            void deselectAll();
+
+            const view::SelectionSet& selection() const;
+
+            /** @brief Node or edge behind a selection index, or nullptr once released. */
+            QGraphicsItem* selectableItem(view::SelectionSet::Index index) const;
+
+            /** @brief Emitted once per selection change with the indices that flipped. */
+            base::mvp::utility::Signal<const view::SelectionSet::Delta&> selection_changed;
+            ///@}
+
+            /**
+             * @name Group move
+             * Moves the selected nodes as one transaction. Edges between two moving
+             * nodes are shifted rigidly, without rebuilding their curve; only edges
+             * crossing the selection boundary are rebuilt, once per frame. Dragging
+             * a selected node goes through this path.
+             */
+            ///@{
+            /** @brief Capture the selected nodes and sort their edges into internal and boundary ones. */
+            void beginGroupMove();
+            /** @brief Translate the captured nodes by a scene-space @p delta. */
+            void moveGroup(const QPointF& delta);
+            /** @brief Bring boundary edges up to date and close the transaction. */
+            void endGroupMove();
+            bool isGroupMoving() const;
+
+            /**
+             * @brief Drag large selections as one cached image.
+             * @param minNodes Smaller selections move their items directly.
+             *
+             * At the start of a group move the selected nodes and the edges between
+             * them are painted once into a pixmap. That pixmap moves during the drag
+             * while the items stay put, fully transparent; only boundary edges are
+             * redrawn. The items are moved and shown again on drop.
+             */
+            void setDragSnapshotEnabled(bool enabled, int minNodes = 64);
+            bool dragSnapshotEnabled() const;
+            ///@}
+
+            /**
+             * @brief Input-to-paint latency of interactive drags.
+             *
+             * Measured from the scene receiving a drag move to the next paint of
+             * the scene. Moves are coalesced: only the latest position is applied,
+             * once per frame, so the cost per frame does not grow with the backlog.
+             */
+            struct DragLatency
+            {
+                quint64 samples = 0;
+                quint64 coalesced = 0; ///< Moves superseded by a later one before being applied.
+                qint64 lastNs = 0;
+                qint64 maxNs = 0;
+                qint64 totalNs = 0;
+
+                qint64 averageNs() const { return samples ? totalNs / qint64(samples) : 0; }
+            };
+
+            const DragLatency& dragLatency() const;
+            void resetDragLatency();
+
+            /**
+             * @brief Apply a queued move right away once it has waited @p milliseconds.
+             *
+             * Bounds the wait when the event loop is too busy to reach the next frame.
+             */
+            void setDragLatencyBudget(int milliseconds);
+            int dragLatencyBudget() const;
+
+        protected:
+            void drawForeground(QPainter* painter, const QRectF& rect) override;
+
         private:
             void mousePressEvent(QGraphicsSceneMouseEvent* event) override;
+            void mouseMoveEvent(QGraphicsSceneMouseEvent* event) override;
+            void mouseReleaseEvent(QGraphicsSceneMouseEvent* event) override;
+
+            /** @brief Arm a connection drag if @p scenePos lies on a port; returns true if armed. */
+            bool beginConnectionDrag(const QPointF& scenePos);
+            /** @brief Move the preview end, snapping it to the nearest compatible port. */
+            void updateConnectionDrag(const QPointF& scenePos);
+            /** @brief Drop the preview and connect to the snapped port, if any. */
+            void finishConnectionDrag();
+
+            /** @brief Rebuild boundary edges for the movement accumulated since the last frame. */
+            void flushGroupMove();
+            /** @brief Paint the group into a pixmap item and make its items transparent. */
+            void takeDragSnapshot();
+            /** @brief Move the items to where the snapshot was dropped and show them again. */
+            void commitDragSnapshot();
+
+            /** @brief Remember the latest drag position and apply it on the next frame. */
+            void queueDragMove(const QPointF& scenePos);
+            /** @brief Apply the queued drag position, if any. */
+            void applyDragMove();
+
+            /** @brief Port item, else node, else edge at @p scenePos, from the spatial index. */
+            QGraphicsItem* pickItem(const QPointF& scenePos);
+
+            bool isEdgeBatchable(const view::ConnectionPathView* edge) const;
+            void batchEdge(view::ConnectionPathView* edge);
+            void promoteEdge(view::ConnectionPathView* edge);
+            void scheduleEdgeBatch(view::ConnectionPathView* edge);
+            void flushEdgeBatch();
+
+            /** @brief Shift every edge attached to @p nodeName by the node's move delta. */
+            void translateNodeEdges(const QString& nodeName, const QPointF& delta);
+
+            /** @brief Re-anchor edges attached to painted rows after the node re-laid out. */
+            void refreshRowEdges(const QString& nodeName);
+
+            bool createRowConnection(const QString& fromNode,
+                                     const QString& fromPort,
+                                     const QString& toNode,
+                                     const QString& toPort);
+            void registerConnection(const std::shared_ptr<presenter::ConnectionPathPresenter>& presenter,
+                                    view::ConnectionPathView* rawView);
+            void detachNodeEdge(view::ConnectionPathView* edge);
+
+            /** @brief Presenter of a node, materializing it first if it is parked. */
+            std::shared_ptr<presenter::NodeItemPresenter> liveNode(const QString& nodeId);
+            void attachNodeView(const QString& name, view::NodeItemView* nodeView, const std::shared_ptr<model::NodeItemModel>& nodeModel);
+            void detachNodeView(view::NodeItemView* nodeView);
+            bool canPark(const QString& name) const;
+            bool parkNode(const QString& name);
+            void scheduleVirtualization();
+
+            /** @brief One endpoint of an edge, attached to a node. */
+            struct NodeEdgeEnd
+            {
+                view::ConnectionPathView* edge = nullptr;
+                bool inputEnd = false; ///< True for the edge's input (from) end.
+                QString rowName;       ///< Port name when attached to a painted row, else empty.
+                QString portName;      ///< Port name when attached to an item port, else empty.
+                view::PortItemView* port = nullptr; ///< Item port followed through @ref portSlot while its node is live.
+                std::size_t portSlot = 0;           ///< Connection on the port's pos_changed.
+            };
+
+            /** @brief Keep @p end of its edge on @p port as the port is laid out. */
+            void bindPortEdge(NodeEdgeEnd& end, view::PortItemView* port);
+            /** @brief Stop following the port of @p end, before the edge or the port goes away. */
+            void unbindPortEdge(NodeEdgeEnd& end);
 
             std::unordered_map<QString, std::shared_ptr<nodeeditor::core::presenter::NodeItemPresenter>> m_nodes;
             std::vector<std::shared_ptr<nodeeditor::core::presenter::ConnectionPathPresenter>> m_connections;
+
+            view::EdgeLayerItem* m_edgeLayer = nullptr; ///< Owned by the scene once added.
+            std::unordered_set<view::ConnectionPathView*> m_pendingBatch;
+
+            // Edge endpoints per node name, so a node move is one pass over its own edges.
+            std::unordered_map<QString, std::vector<NodeEdgeEnd>> m_nodeEdges;
+            std::unordered_map<view::ConnectionPathView*, std::pair<QString, QString>> m_edgeNodes;
+
+            /** @brief Painted parameter of a parked node. */
+            struct ParkedParameter
+            {
+                std::uint32_t typeId = 0;
+                QString name;
+                QString displayName;
+                QVariant value;
+            };
+
+            /** @brief Painted port row or item port of a parked node. */
+            struct ParkedRow
+            {
+                QString name;
+                QString displayName;
+                common::taggable::TagBitMask tags;
+            };
+
+            /** @brief Everything needed to rebuild a parked node's view. */
+            struct ParkedNode
+            {
+                std::shared_ptr<model::NodeItemModel> model;
+                QVector<ParkedRow> inputRows;
+                QVector<ParkedRow> outputRows;
+                QVector<ParkedRow> inputPorts;  ///< Item ports, rebuilt with their presenters.
+                QVector<ParkedRow> outputPorts;
+                QVector<ParkedParameter> parameters;
+                int portRowLimit = 0;
+            };
+
+            bool m_virtualized = false;
+            bool m_virtualizationPending = false;
+            qreal m_virtualMargin = 512.0;
+            QRectF m_viewportRect;
+            std::unordered_map<QString, ParkedNode> m_parkedNodes;
+            view::SpatialGrid<QString> m_parkedIndex{1024.0}; ///< Cached scene bounds of parked nodes.
+
+            view::SpatialIndex m_spatialIndex;
+            QGraphicsItem::CacheMode m_nodeCacheMode = QGraphicsItem::NoCache;
+
+            /** @brief Scene item behind a selection index; exactly one pointer is set while live. */
+            struct Selectable
+            {
+                view::NodeItemView* node = nullptr;
+                view::ConnectionPathView* edge = nullptr;
+                std::weak_ptr<model::NodeItemModel> nodeModel;
+                std::weak_ptr<model::ConnectionPathModel> edgeModel;
+            };
+
+            void addSelectable(QGraphicsItem* item, const Selectable& selectable);
+            void removeSelectable(QGraphicsItem* item);
+            /** @brief Mirror a SelectionSet delta onto the items, then announce it once. */
+            void applySelection(const view::SelectionSet::Delta& delta);
+            void setSelectableSelected(view::SelectionSet::Index index, bool selected);
+            /** @brief Bring the models behind a delta in line with their silently updated views. */
+            void pushSelectionToModels(const view::SelectionSet::Delta& delta);
+            /** @brief Record a selection change that went through the item itself (click, Qt rubber band). */
+            void syncItemSelection(QGraphicsItem* item, bool selected);
+
+            view::SelectionSet m_selection;
+            std::vector<Selectable> m_selectables;
+            std::unordered_map<const QGraphicsItem*, view::SelectionSet::Index> m_selectableIds;
+
+            /** @brief New connection being dragged out of a port. */
+            struct ConnectionDrag
+            {
+                bool armed = false; ///< Pressed on a port; the drag starts past the drag distance.
+                view::SpatialIndex::PortHit source;
+                QPointF pressPos;
+                std::shared_ptr<view::ConnectionPathView> preview;
+                std::optional<view::SpatialIndex::PortHit> target;
+            };
+
+            ConnectionDrag m_connectionDrag;
+
+            /** @brief State of the running group move, see @ref beginGroupMove. */
+            struct GroupMove
+            {
+                bool active = false;
+                std::unordered_set<view::NodeItemView*> nodes;
+                std::vector<view::ConnectionPathView*> internalEdges;
+                std::vector<std::pair<view::ConnectionPathView*, bool>> boundaryEdges; ///< <edge, input end moves>
+                QPointF pendingDelta; ///< Movement boundary edges have not caught up with yet.
+
+                QGraphicsPixmapItem* snapshot = nullptr; ///< Stands in for the group while dragged, if any.
+                QPointF snapshotOffset;                  ///< Movement the items have not received yet.
+                std::vector<std::pair<QGraphicsItem*, qreal>> hiddenItems; ///< <item, opacity to restore>
+            };
+
+            GroupMove m_groupMove;
+            bool m_dragSnapshot = false;
+            int m_dragSnapshotMinNodes = 64;
+            view::NodeItemView* m_pressedNode = nullptr; ///< Selected node under a left press, may start a group move.
+            QPointF m_lastDragPos;
+
+            /** @brief Latest drag move not applied yet. */
+            struct PendingMove
+            {
+                bool pending = false;
+                QPointF scenePos;
+                qint64 receivedNs = 0; ///< When the oldest move of the coalesced run arrived.
+            };
+
+            PendingMove m_pendingMove;
+            QElapsedTimer m_inputClock;
+            qint64 m_latencyBudgetNs = 32'000'000;
+            qint64 m_awaitingPaintNs = -1; ///< Receive time of the applied move not painted yet, or -1.
+            DragLatency m_dragLatency;
         };
 
     } // namespace core
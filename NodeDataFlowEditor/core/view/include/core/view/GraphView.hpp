@@ -1,77 +1,377 @@
-// /*
-//     MIT License
-
-//     Copyright (c) 2025 Joseph Al Hajjar
-
-//     Permission is hereby granted, free of charge, to any person obtaining a copy
-//     of this software and associated documentation files (the "Software"), to deal
-//     in the Software without restriction, including without limitation the rights
-//     to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-//     copies of the Software, and to permit persons to whom the Software is
-//     furnished to do so, subject to the following conditions:
-
-//     The above copyright notice and this permission notice shall be included in
-//     all copies or substantial portions of the Software.
-
-//     THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-//     IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-//     FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-//     AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-//     LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-//     THE SOFTWARE.
-// */
-
-// #pragma once
-
-// #include <QGraphicsView>
-
-// class GraphScene;
-// class QWheelEvent;
-// class QKeyEvent;
-
-// /**
-//  * @brief Custom graphics view for displaying and interacting with the node-based scene.
-//  *
-//  * GraphView provides specialized handling for zooming, panning, and keyboard shortcuts
-//  * within the node editor. It extends QGraphicsView to support intuitive navigation
-//  * and event forwarding to the Scene.
-//  */
-// class GraphView final : public QGraphicsView
-// {
-//     Q_OBJECT
-
-// public:
-//     /**
-//      * @brief Construct a new GraphView bound to a Scene.
-//      * @param scene The Scene instance to visualize and interact with.
-//      * @param parent Optional parent widget.
-//      *
-//      * The view initializes custom interaction settings and connects to the given Scene
-//      * for event handling and rendering.
-//      */
-//     explicit GraphView(GraphScene* scene, QWidget* parent = nullptr);
-
-// protected:
-//     /**
-//      * @brief Handle mouse wheel events for zooming in and out of the scene.
-//      * @param event Wheel input event providing scroll direction and delta.
-//      *
-//      * Typically used to scale the view smoothly around the cursor position.
-//      */
-//     void wheelEvent(QWheelEvent* event) override;
-
-//     /**
-//      * @brief Handle keyboard press events for scene navigation or shortcuts.
-//      * @param event Key press event.
-//      *
-//      * Allows camera panning, selection toggling, or other editor-level shortcuts.
-//      */
-//     void keyPressEvent(QKeyEvent* event) override;
-
-//     /**
-//      * @brief Handle keyboard release events for state cleanup after key presses.
-//      * @param event Key release event.
-//      */
-//     void keyReleaseEvent(QKeyEvent* event) override;
-// };
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "core/view/PaintDetail.hpp"
+#include "core/view/RenderQuality.hpp"
+#include "mvp/utility/Signal.hpp"
+#include <QGraphicsItem>
+#include <QGraphicsView>
+#include <QPixmap>
+#include <QRegion>
+#include <QTimer>
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+class QKeyEvent;
+class QMouseEvent;
+class QPaintEvent;
+class QResizeEvent;
+class QRubberBand;
+class QWheelEvent;
+
+namespace nodeeditor::core
+{
+    class NodeEditorScene;
+} // namespace nodeeditor::core
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Graphics view for displaying and navigating a NodeEditorScene.
+     *
+     * Wheel zooms around the cursor, the middle button (or Ctrl + left drag) pans.
+     * The background grid is drawn from a small tile pixmap, rendered once per
+     * zoom level and repeated over the exposed area. Only the bounding rect of
+     * changed items is repainted; scrolling blits the viewport and paints the
+     * uncovered strip.
+     *
+     * Visible-rect changes are reported to the scene once per frame through
+     * NodeEditorScene::updateViewport and NodeEditorScene::prefetchAround.
+     *
+     * With adaptive updates on, the viewport update mode and the node cache
+     * mode follow the dirty-region statistics of recent frames, see
+     * @ref setAdaptiveUpdatesEnabled.
+     */
+    class GraphView : public QGraphicsView
+    {
+        Q_OBJECT
+
+    public:
+        /** @brief Repainted viewport area, to compare against full-viewport updates. */
+        struct RepaintStats
+        {
+            quint64 frames = 0;
+            quint64 fullFrames = 0; ///< Frames that repainted the whole viewport.
+            quint64 snapshotFrames = 0; ///< Frames drawn from the zoom snapshot instead of the scene.
+            qint64 lastArea = 0;    ///< Pixels repainted by the latest frame.
+            int lastRects = 0;      ///< Dirty rects of the latest frame.
+            int lastItems = 0;      ///< Items under the latest dirty region; counted in adaptive mode only.
+            qint64 totalArea = 0;
+            qint64 viewportArea = 0; ///< Sum of the viewport area over all frames.
+
+            /** @brief Share of the viewport actually repainted, 1.0 being full updates. */
+            qreal coverage() const { return viewportArea ? qreal(totalArea) / qreal(viewportArea) : 0.0; }
+        };
+
+        /**
+         * @brief Construct a view bound to a scene.
+         * @param scene The scene to show; may be null and set later with setScene().
+         * @param parent Optional parent widget.
+         */
+        explicit GraphView(NodeEditorScene* scene, QWidget* parent = nullptr);
+        ~GraphView() override;
+
+        /** @brief Current scale factor of the view transform. */
+        qreal zoom() const;
+
+        /**
+         * @brief Scale the view by @p factor around @p viewPos, clamped to the zoom range.
+         * @param viewPos Anchor in viewport coordinates; stays over the same scene point.
+         */
+        void zoomBy(qreal factor, const QPointF& viewPos);
+
+        void setZoomRange(qreal minimum, qreal maximum);
+        qreal minimumZoom() const;
+        qreal maximumZoom() const;
+
+        /**
+         * @brief Draw wheel zoom gestures from a scaled snapshot of the viewport.
+         * @param settleMilliseconds Quiet time after the last wheel step before the scene is re-rendered.
+         *
+         * The first wheel step grabs the viewport once. Further steps only change
+         * the transform: frames draw the grid and the snapshot scaled into place,
+         * without painting a single item or reporting the viewport to the scene.
+         * Once the wheel has been quiet for the settle delay, or on any mouse
+         * press or resize, the scene is rendered again at full quality.
+         */
+        void setZoomSnapshotEnabled(bool enabled, int settleMilliseconds = 150);
+        bool zoomSnapshotEnabled() const;
+        bool isZoomGestureActive() const;
+
+        /**
+         * @brief Refine the viewport over several frames when a full frame is too slow.
+         * @param budgetMilliseconds Paint time allowed per event-loop turn.
+         *
+         * Once a full-detail frame has taken longer than the budget, the next
+         * viewport change (scroll, zoom, resize) paints nodes as flat rects
+         * first, then repaints the viewport tile by tile with cached bodies, then
+         * again with edges, rows and labels. Each turn paints tiles until the
+         * budget is spent, nearest to the centre first. A viewport change during
+         * a pass aborts it and starts over. Items read the level through
+         * PaintDetail. Node item caches are off while a pass runs.
+         */
+        void setProgressiveRenderingEnabled(bool enabled, int budgetMilliseconds = 12);
+        bool progressiveRenderingEnabled() const;
+        /** @brief True while a progressive pass has tiles left to refine. */
+        bool isRefining() const;
+        /** @brief Paint time of the latest full-detail frame, whole or summed over tiles. */
+        qint64 fullFrameNs() const;
+
+        /**
+         * @brief Trade rendering quality for frame time, one RenderQuality level at a time.
+         * @param targetMilliseconds Paint time per frame to stay under.
+         * @param windowFrames Painted frames in the sliding window.
+         *
+         * A frame is every paint event of one event-loop turn; frames repainting
+         * less than half the viewport say little about full-frame cost and are
+         * not counted. Paint time is averaged over the last @p windowFrames
+         * frames. Above the target the quality drops one level; below half the
+         * target it rises one level. After a change the window refills before
+         * the next decision.
+         * Disabling returns to full quality.
+         */
+        void setFrameGovernorEnabled(bool enabled, qreal targetMilliseconds = 16.0, int windowFrames = 60);
+        bool frameGovernorEnabled() const;
+        /** @brief Average paint time over the current window, in nanoseconds. */
+        qint64 averageFrameNs() const;
+
+        /** @brief Current quality level; shorthand for RenderQuality::instance().level(). */
+        RenderQuality::Level qualityLevel() const;
+        /** @brief Why the quality is at its current level, for logging. */
+        QString qualityReason() const;
+
+        /**
+         * @brief Configure the background grid.
+         * @param spacing Distance between minor lines in scene units.
+         * @param majorEvery Number of minor cells between two major lines.
+         */
+        void setGrid(qreal spacing, int majorEvery = 5);
+        qreal gridSpacing() const;
+        void setGridVisible(bool visible);
+        bool isGridVisible() const;
+        void setGridColors(const QColor& background, const QColor& minor, const QColor& major);
+
+        /** @brief Drop every cached grid tile; they are re-rendered on the next paint. */
+        void clearGridCache();
+
+        const RepaintStats& repaintStats() const;
+        void resetRepaintStats();
+
+        /** @brief Modes currently applied by the adaptive strategy. */
+        struct UpdateStrategy
+        {
+            ViewportUpdateMode viewportMode = BoundingRectViewportUpdate;
+            QGraphicsItem::CacheMode nodeCache = QGraphicsItem::NoCache;
+            quint64 switches = 0; ///< Number of times either mode changed.
+        };
+
+        /** @brief Per-frame averages over the last complete sampling window. */
+        struct UpdateWindow
+        {
+            int frames = 0;
+            qreal coverage = 0.0;    ///< Share of the viewport repainted.
+            qreal rects = 0.0;       ///< Dirty rects.
+            qreal items = 0.0;       ///< Items under the dirty region.
+            qreal scrollShare = 0.0; ///< Share of frames following a scroll.
+            qreal zoomShare = 0.0;   ///< Share of frames following a zoom.
+        };
+
+        /**
+         * @brief Pick the viewport update mode and node cache mode from measured frames.
+         * @param windowFrames Painted frames averaged per decision.
+         *
+         * Large or scrolling repaints switch to full viewport updates, many
+         * scattered dirty rects to bounding-rect updates, and the rest to
+         * minimal updates. Nodes are cached in device coordinates while the
+         * view pans without zooming. A new choice must win two windows in a
+         * row, and each switch has separate enter and leave thresholds, so the
+         * modes do not flip on borderline frames. Disabling restores
+         * bounding-rect updates and uncached nodes.
+         */
+        void setAdaptiveUpdatesEnabled(bool enabled, int windowFrames = 30);
+        bool adaptiveUpdatesEnabled() const;
+        const UpdateStrategy& updateStrategy() const;
+        const UpdateWindow& updateWindow() const;
+
+        /** @brief Emitted after the adaptive strategy switched a mode. */
+        base::mvp::utility::Signal<const UpdateStrategy&> strategy_changed;
+
+    protected:
+        void drawBackground(QPainter* painter, const QRectF& rect) override;
+        void paintEvent(QPaintEvent* event) override;
+        void resizeEvent(QResizeEvent* event) override;
+        void scrollContentsBy(int dx, int dy) override;
+
+        void wheelEvent(QWheelEvent* event) override;
+        void mousePressEvent(QMouseEvent* event) override;
+        void mouseMoveEvent(QMouseEvent* event) override;
+        void mouseReleaseEvent(QMouseEvent* event) override;
+
+        /**
+         * @brief Ctrl switches left drags from rubber band selection to panning.
+         *
+         * The rubber band is the view's own: it selects through
+         * NodeEditorScene::selectRect(), one delta per update, instead of Qt's
+         * per-item setSelected() cascade.
+         */
+        void keyPressEvent(QKeyEvent* event) override;
+        void keyReleaseEvent(QKeyEvent* event) override;
+
+    private:
+        /** @brief Tile for the current zoom level, rendering it on a miss. */
+        const QPixmap& gridTile(qreal pixelRatio);
+        /** @brief Zoom level a tile is cached under: pixel ratio in 1/8 octave steps. */
+        static int gridLevel(qreal pixelRatio);
+
+        void beginZoomGesture();
+        /** @brief Drop the snapshot and repaint the scene at the settled zoom. */
+        void endZoomGesture();
+        void paintZoomSnapshot(QPaintEvent* event);
+
+        /** @brief Restart progressive refinement if the view changed and full frames are too slow. */
+        void viewportChanged();
+        void startProgressivePass();
+        /** @brief Repaint queued tiles at the pass level until the budget is spent. */
+        void refineProgressivePass();
+        /** @brief Switch node caches off for a pass; a cached pixmap would keep the level it was painted at. */
+        void suspendNodeCache();
+        void restoreNodeCache();
+        /** @brief Viewport tiles ordered from the centre outwards. */
+        std::vector<QRect> progressiveTiles() const;
+
+        /** @brief Add one paint event to the current frame; the frame is governed on the next turn. */
+        void recordFramePaint(qint64 paintNs, qint64 area, qint64 full);
+        /** @brief Add a frame's paint time to the governor window; step the quality once it is full. */
+        void governFrame(qint64 paintNs);
+        void setQuality(RenderQuality::Level level, const QString& reason);
+
+        /** @brief Add the frame just painted to the sampling window; decide once it is full. */
+        void sampleFrame(const QRegion& region, qint64 area, qint64 full);
+        /** @brief Choose modes from @ref m_window, with hysteresis against the current ones. */
+        void adaptStrategy();
+        void applyStrategy(const UpdateStrategy& strategy);
+
+        /** @brief Report the visible scene rect to the scene on the next frame. */
+        void scheduleViewportSync();
+        void syncViewport();
+
+        NodeEditorScene* nodeScene() const;
+
+    private:
+        static constexpr int MaxGridTiles = 8;
+        static constexpr qreal GovernorMinCoverage = 0.5; ///< Viewport share a frame must repaint to be governed.
+
+        qreal m_zoom = 1.0; ///< Cached transform().m11(), kept in step by zoomBy().
+        qreal m_minZoom = 0.1;
+        qreal m_maxZoom = 5.0;
+
+        bool m_panning = false;
+        QPoint m_panOrigin;
+
+        /** @brief Select the scene area under the rubber band in one pass. */
+        void updateRubberBand(const QPoint& pos);
+        QRubberBand* m_rubberBand = nullptr; ///< Created on first use; owned by the viewport.
+        bool m_banding = false;
+        QPoint m_bandOrigin;
+
+        qreal m_gridSpacing = 20.0;
+        int m_gridMajorEvery = 5;
+        bool m_gridVisible = true;
+        QColor m_gridBackground{0x30, 0x30, 0x30};
+        QColor m_gridMinor{0x3a, 0x3a, 0x3a};
+        QColor m_gridMajor{0x24, 0x24, 0x24};
+
+        std::unordered_map<int, QPixmap> m_gridTiles;
+        std::list<int> m_gridLru; ///< Front is the most recently used level.
+
+        QRectF m_reportedRect; ///< Visible rect the scene was last told about.
+
+        RepaintStats m_repaintStats;
+
+        /** @brief Viewport image standing in for the scene during a zoom gesture. */
+        struct ZoomGesture
+        {
+            bool active = false;
+            QPixmap snapshot;
+            QRectF sceneRect; ///< Scene area the snapshot shows.
+        };
+
+        /** @brief Progressive refinement of the viewport, see @ref setProgressiveRenderingEnabled. */
+        struct ProgressivePass
+        {
+            bool active = false;
+            PaintDetail::Level level = PaintDetail::Bodies; ///< Level tiles are being refined to.
+            std::vector<QRect> tiles;
+            std::size_t next = 0;
+            QRegion done;     ///< Tiles already painted at @ref level.
+            QRegion redo;     ///< Parts of @ref done repainted at a lower level meanwhile.
+            qint64 fullNs = 0; ///< Paint time summed over the full-detail tiles.
+        };
+
+        bool m_progressive = false;
+        qint64 m_paintBudgetNs = 12'000'000;
+        qint64 m_fullFrameNs = 0;
+        bool m_refining = false; ///< Inside a repaint issued by the pass itself.
+        ProgressivePass m_pass;
+        bool m_cacheSuspended = false; ///< Node caches are off for the running pass.
+        QGraphicsItem::CacheMode m_cacheBeforePass = QGraphicsItem::NoCache;
+
+        bool m_governor = false;
+        qint64 m_frameTargetNs = 16'000'000;
+        int m_governorFrames = 60;
+        std::deque<qint64> m_frameTimes; ///< Paint times of the sliding window, oldest first.
+        qint64 m_frameTimeSum = 0;
+        qint64 m_pendingFrameNs = 0;   ///< Paint time of the current turn so far.
+        qint64 m_pendingFrameArea = 0; ///< Pixels repainted in the current turn so far.
+
+        bool m_zoomSnapshot = false;
+        ZoomGesture m_zoomGesture;
+        QTimer m_zoomSettleTimer;
+
+        /** @brief Running sums of the sampling window being filled. */
+        struct WindowSums
+        {
+            int frames = 0;
+            qreal coverage = 0.0;
+            qint64 rects = 0;
+            qint64 items = 0;
+            int scrolled = 0;
+            int zoomed = 0;
+        };
+
+        bool m_adaptive = false;
+        int m_windowFrames = 30;
+        bool m_scrolledSinceFrame = false;
+        bool m_zoomedSinceFrame = false;
+        WindowSums m_sums;
+        UpdateWindow m_window;
+        UpdateStrategy m_strategy;
+        UpdateStrategy m_candidate; ///< Choice waiting for confirmation.
+        int m_candidateWins = 0;
+    };
+} // namespace nodeeditor::core::view
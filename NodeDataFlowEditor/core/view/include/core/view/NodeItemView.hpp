@@ -1,13 +1,17 @@
 ﻿#pragma once
 
 #include "common/view/AbstractItemView.hpp"
+#include "core/view/NodeRenderCache.hpp"
+#include "core/view/PortTable.hpp"
 #include <QGraphicsProxyWidget>
+#include <QHash>
 #include <QLineEdit>
 #include <QPainter>
 
 namespace nodeeditor::core::view
 {
     class EditableArrowItemView;
+    class ParameterControl;
     class PortItemView;
 
     class NodeItemView : public nodeeditor::common::view::AbstractItemView
@@ -24,6 +28,17 @@ namespace nodeeditor::core::view
 
         ~NodeItemView() override;
 
+        /**
+         * @brief Drop ports, rows, parameters and connections before the view is pooled.
+         * @see ViewPool
+         */
+        void recycle();
+
+        /** @brief Re-initialize a pooled view; same arguments as the two-name constructor. */
+        void resetForReuse(QString nodeName,
+                           const QString& nodeDisplayedName = "",
+                           QGraphicsItem* parent = nullptr);
+
         QVector<std::shared_ptr<PortItemView>> getAllPorts() const;
 
         std::shared_ptr<PortItemView> addInput(const QString& name);
@@ -41,9 +56,16 @@ namespace nodeeditor::core::view
 
         QRectF boundingRect() const override;
         void paint(QPainter* painter,
-                   const QStyleOptionGraphicsItem*,
+                   const QStyleOptionGraphicsItem* option,
                    QWidget*) override;
 
+        /** @brief Hash lookup of an item port by internal name. */
+        std::shared_ptr<PortItemView> findInput(const QString& name) const;
+        std::shared_ptr<PortItemView> findOutput(const QString& name) const;
+
+        /** @brief Number of ports of every kind, painted rows included, without copying. */
+        int portCount() const;
+
         QVector<std::shared_ptr<PortItemView>> inputs() const;
         QVector<std::shared_ptr<PortItemView>> outputs() const;
 
@@ -53,6 +75,15 @@ namespace nodeeditor::core::view
         std::shared_ptr<PortItemView> addParameter(QWidget* widget, const QString& name);
         std::shared_ptr<PortItemView> addParameter(QWidget* widget, const QString& name, const QString& displayName);
 
+        /**
+         * @brief Add a parameter edited through a painted control.
+         *
+         * The node takes ownership of @p control. Unlike the QWidget overload,
+         * no proxy widget exists until the control is actually being edited.
+         */
+        std::shared_ptr<PortItemView> addParameter(ParameterControl* control, const QString& name, const QString& displayName = QString());
+        ParameterControl* getParameterControl(const std::shared_ptr<PortItemView>& port) const;
+
         QMap<QWidget*, QGraphicsProxyWidget*> parameterWidgets() const;
         QWidget* getParameterWidget(std::shared_ptr<PortItemView>) const;
         QMap<std::shared_ptr<PortItemView>, QGraphicsProxyWidget*> parameterPorts() const;
@@ -64,12 +95,85 @@ namespace nodeeditor::core::view
         QString nodeName() const;
         void setNodeNameColor(const QColor& c);
 
+        /**
+         * @brief Queue this node's body for background rasterization.
+         * @param pixelRatio Device pixel ratio times the view scale it will be drawn at.
+         *
+         * No-op unless NodeRasterizer is enabled or when the body is already cached.
+         */
+        void prefetchBody(qreal pixelRatio) const;
+
+        /**
+         * @name Compact port rows
+         * Ports kept as PortTable rows and painted by the node itself. A real
+         * PortItemView exists only while a row is hovered, pressed or edited.
+         */
+        ///@{
+        /** @brief Add a painted input row; fails if the name is already used on that side. */
+        bool addInputRow(const QString& name, const QString& displayName = QString());
+        /** @brief Add a painted output row; fails if the name is already used on that side. */
+        bool addOutputRow(const QString& name, const QString& displayName = QString());
+        bool removeRow(PortTable::Side side, const QString& name);
+        const PortTable& portTable() const;
+
+        /**
+         * @brief Show at most @p rows painted rows per column, scrolled with the wheel.
+         *
+         * Rows outside the window are neither painted nor hit-tested; their edges
+         * attach to a collapsed anchor strip above or below it. 0 disables the limit.
+         */
+        void setPortRowLimit(int rows);
+        int portRowLimit() const;
+        void scrollPortRows(int rows);
+
+        /** @brief Record @p delta connections on a row (drives the collapsed anchor marker). */
+        void linkRow(PortTable::Side side, const QString& name, int delta);
+
+        /** @brief Set the compatibility tags of a row; a live stand-in gets them too. */
+        bool setRowTags(PortTable::Side side, const QString& name, const common::taggable::TagBitMask& tags);
+
+        /** @brief Scene rect of a row, for anchoring connections. */
+        bool rowSceneRect(PortTable::Side side, const QString& name, QRectF* rect) const;
+
+        /** @brief The item currently standing in for a row, if any. */
+        std::shared_ptr<PortItemView> liveRowPort() const;
+
+        /** @brief Emitted after a measure pass moved or resized rows. */
+        base::mvp::utility::Signal<> rows_changed;
+
+        /** @brief Emitted after every arrange pass, once the ports sit at their new offsets. */
+        base::mvp::utility::Signal<> layout_changed;
+        ///@}
+
         void disconnectAllPorts();
         std::shared_ptr<PortItemView> getPort(const QGraphicsProxyWidget& poxy) const;
+
+        /** @brief Re-measure and arrange immediately, bypassing the per-frame batching. */
         void updateLayout();
 
+        /**
+         * @brief Mark sizes as stale (ports or labels changed).
+         *
+         * The measure pass runs once on the next frame, followed by arrange.
+         */
+        void requestMeasure();
+
+        /** @brief Re-apply the cached node-local port offsets; sizes are kept. */
+        void requestArrange();
+
+        /** @brief Run any pending measure/arrange pass now. */
+        void flushLayout();
+
         base::mvp::utility::Signal<const std::string&> text_changed;
         void set_text(const std::string& t);
+
+        /**
+         * @brief Emitted once per move with the scene-space delta.
+         *
+         * Ports are children in node-local coordinates and do not notify on a
+         * move, so this is the single hook for keeping attached edges in place.
+         */
+        base::mvp::utility::Signal<const QPointF&> moved_by;
         std::shared_ptr<PortItemView> addPortView(
             const std::shared_ptr<PortItemView>& port,
             QWidget* widget = nullptr);
@@ -77,12 +181,41 @@ namespace nodeeditor::core::view
     protected:
         void updateRect();
 
+        void hoverMoveEvent(QGraphicsSceneHoverEvent* event) override;
+        void hoverLeaveEvent(QGraphicsSceneHoverEvent* event) override;
+        void wheelEvent(QGraphicsSceneWheelEvent* event) override;
+
     private:
         std::shared_ptr<PortItemView> addParamInput(const QString& name);
 
-        void drawBackground(QPainter& painter) const;
-        void drawTitle(QPainter& painter) const;
-        void drawGlowingBounding(QPainter& painter);
+        /** @brief Computes the node rect and node-local port offsets. */
+        void measure();
+        /** @brief Moves ports to their cached node-local offsets. */
+        void arrange();
+        void scheduleLayout();
+
+        /** @brief Derive @ref moved_by from pos_changed; re-done after a pool reset. */
+        void trackMoves();
+
+        bool addRow(PortTable::Side side, const QString& name, const QString& displayName);
+        void materializeRow(const PortTable::RowRef& ref);
+        void releaseLiveRow();
+        void scheduleLiveRowRelease();
+        bool canReleaseLiveRow() const;
+
+        void paintBody(QPainter& painter);
+
+        /** @brief Appearance key of this node's body for the given painter. */
+        NodeBodyKey bodyKey(const QPainter& painter) const;
+        NodeBodyKey bodyKey(qreal pixelRatio) const;
+
+        /** @brief Cheap stand-in painted while the body is being rasterized. */
+        static void drawPlaceholder(QPainter& painter, const NodeBodyKey& key);
+
+        static void drawBody(QPainter& painter, const NodeBodyKey& key);
+        static void drawBackground(QPainter& painter, const NodeBodyKey& key);
+        static void drawTitle(QPainter& painter, const NodeBodyKey& key);
+        static void drawGlowingBounding(QPainter& painter, const NodeBodyKey& key);
         void setActive(bool newIsActive);
 
     private:
@@ -93,6 +226,8 @@ namespace nodeeditor::core::view
 
         QVector<std::shared_ptr<PortItemView>> m_inputs;
         QVector<std::shared_ptr<PortItemView>> m_outputs;
+        QHash<QString, std::shared_ptr<PortItemView>> m_inputIndex;
+        QHash<QString, std::shared_ptr<PortItemView>> m_outputIndex;
 
         qreal m_titleHeight = 30;
         int m_margin = 20;
@@ -109,8 +244,22 @@ namespace nodeeditor::core::view
 
         QMap<QWidget*, QGraphicsProxyWidget*> m_parameterWidgets;
         QMap<std::shared_ptr<PortItemView>, QGraphicsProxyWidget*> m_parameterPorts;
+        QMap<std::shared_ptr<PortItemView>, ParameterControl*> m_parameterControls; ///< Ports whose proxy entry is null.
 
         QSize m_paramsRectSize;
+
+        // Layout is split so that a pure move only re-applies cached offsets.
+        bool m_measureDirty = true;
+        bool m_arrangeDirty = true;
+        QPointF m_lastPos;
+        QVector<QPointF> m_inputOffsets;
+        QVector<QPointF> m_outputOffsets;
+        QVector<QPointF> m_paramOffsets;
+
+        PortTable m_portTable;
+        PortTable::RowRef m_liveRow;
+        std::shared_ptr<PortItemView> m_liveRowPort;
+        bool m_liveRowPinned = false; ///< Live row is pressed; keep it until release.
     };
 
 } // namespace nodeeditor::core::view
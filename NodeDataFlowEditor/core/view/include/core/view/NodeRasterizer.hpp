@@ -0,0 +1,98 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "core/view/NodeRenderCache.hpp"
+#include "mvp/utility/Signal.hpp"
+#include <QObject>
+#include <QThreadPool>
+#include <unordered_map>
+#include <vector>
+
+class QGraphicsItem;
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Rasterizes node bodies on worker threads ahead of need.
+     *
+     * Jobs paint into a QImage (safe off the GUI thread) and hand the result
+     * back to the GUI thread, which converts it and stores it in
+     * NodeRenderCache. While a body is in flight, items paint a cheap
+     * placeholder and are repainted as soon as the image lands.
+     *
+     * Disabled by default; when disabled every miss is rendered synchronously.
+     */
+    class NodeRasterizer : public QObject
+    {
+    public:
+        /** @brief Counters for hitch analysis during fast pans. */
+        struct Stats
+        {
+            quint64 submitted = 0;    ///< Jobs queued on the worker pool.
+            quint64 completed = 0;    ///< Images delivered to the cache.
+            quint64 placeholders = 0; ///< Paints that had to fall back to a placeholder.
+            std::size_t pending = 0;  ///< Jobs still in flight.
+        };
+
+        static NodeRasterizer& instance();
+
+        void setEnabled(bool enabled);
+        bool isEnabled() const;
+
+        /** @brief Maximum number of worker threads. */
+        void setMaxThreadCount(int count);
+
+        /**
+         * @brief Queue a body for rasterization unless cached or already in flight.
+         * @param key Appearance key.
+         * @param render Thread-safe painter for the body.
+         * @param waiter Optional item to repaint once the body is ready. Passing
+         *        one counts as a placeholder paint in @ref stats.
+         */
+        void request(const NodeBodyKey& key, const NodeRenderCache::Renderer& render, QGraphicsItem* waiter = nullptr);
+
+        /** @brief Drop an item from every waiting list, e.g. before it is destroyed. */
+        void forget(QGraphicsItem* waiter);
+
+        Stats stats() const;
+        void resetStats();
+
+        /** @brief Emitted on the GUI thread once a body is in the cache. */
+        base::mvp::utility::Signal<const NodeBodyKey&> body_ready;
+
+    private:
+        friend class RasterJob;
+
+        NodeRasterizer();
+
+        void deliver(const NodeBodyKey& key, const QImage& image);
+
+        QThreadPool m_pool;
+        bool m_enabled = false;
+        std::unordered_map<NodeBodyKey, std::vector<QGraphicsItem*>, NodeBodyKeyHash> m_inFlight;
+        Stats m_stats;
+    };
+} // namespace nodeeditor::core::view
@@ -0,0 +1,163 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QColor>
+#include <QImage>
+#include <QPixmap>
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+class QPainter;
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Everything that changes how a node body looks.
+     *
+     * Two nodes with equal keys render to identical pixels, so they can share
+     * one cached image.
+     */
+    struct NodeBodyKey
+    {
+        qreal width = 0.;
+        qreal height = 0.;
+        qreal titleHeight = 0.;
+        QRgb titleColor = 0;
+        QRgb backgroundColor = 0;
+        QRgb borderColor = 0;
+        bool hovered = false;
+        bool selected = false;
+        qreal pixelRatio = 1.; ///< Device pixel ratio times view scale, quantized.
+
+        bool operator==(const NodeBodyKey& other) const
+        {
+            return width == other.width && height == other.height &&
+                   titleHeight == other.titleHeight &&
+                   titleColor == other.titleColor &&
+                   backgroundColor == other.backgroundColor &&
+                   borderColor == other.borderColor &&
+                   hovered == other.hovered && selected == other.selected &&
+                   pixelRatio == other.pixelRatio;
+        }
+
+        bool operator!=(const NodeBodyKey& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    /** @brief Hash functor for NodeBodyKey. */
+    struct NodeBodyKeyHash
+    {
+        std::size_t operator()(const NodeBodyKey& k) const noexcept;
+    };
+
+    /**
+     * @brief Process-wide LRU cache of rendered node bodies.
+     *
+     * Stores one pixmap per NodeBodyKey, evicting the least recently used
+     * entries once the memory budget is exceeded. The pixmap covers the node
+     * rect plus @ref Padding on every side, for the selection glow.
+     *
+     * GUI thread only.
+     */
+    class NodeRenderCache
+    {
+    public:
+        static constexpr qreal Padding = 8.0;       ///< Overhang of the glow around the node rect.
+        static constexpr qreal MaxPixelRatio = 4.0; ///< Above this, bodies are painted directly.
+
+        /** @brief Counters for tuning and frame-time reports. */
+        struct Stats
+        {
+            quint64 hits = 0;
+            quint64 misses = 0;
+            quint64 evictions = 0;
+            qint64 bytes = 0;
+            std::size_t entries = 0;
+        };
+
+        using Renderer = std::function<void(QPainter&)>;
+
+        static NodeRenderCache& instance();
+
+        /**
+         * @brief Return the cached body for @p key, rendering it on a miss.
+         * @param key Appearance key.
+         * @param render Paints the body in node-local coordinates (origin at the rect's top-left).
+         */
+        QPixmap pixmap(const NodeBodyKey& key, const Renderer& render);
+
+        /** @brief Look up a body without rendering. */
+        bool find(const NodeBodyKey& key, QPixmap* out);
+
+        /** @brief Check for a body without touching the LRU order or the stats. */
+        bool contains(const NodeBodyKey& key) const;
+
+        /** @brief Store a body rendered elsewhere. Replaces any previous entry. */
+        void insert(const NodeBodyKey& key, const QPixmap& pixmap);
+
+        /**
+         * @brief Render a body into an image sized for @p key.
+         *
+         * Touches no shared state, so it can run on worker threads as long as
+         * @p render does not either.
+         */
+        static QImage renderImage(const NodeBodyKey& key, const Renderer& render);
+
+        /**
+         * @brief Quantize a raw pixel ratio to half-octave steps.
+         *
+         * Keeps continuous zooming from creating a new entry per frame.
+         */
+        static qreal quantizePixelRatio(qreal ratio);
+
+        void setMemoryBudget(qint64 bytes);
+        qint64 memoryBudget() const;
+
+        void clear();
+        Stats stats() const;
+        void resetStats();
+
+    private:
+        NodeRenderCache() = default;
+
+        void evict();
+
+        struct Entry
+        {
+            QPixmap pixmap;
+            std::list<NodeBodyKey>::iterator lru;
+            qint64 bytes = 0;
+        };
+
+        std::unordered_map<NodeBodyKey, Entry, NodeBodyKeyHash> m_entries;
+        std::list<NodeBodyKey> m_lru; ///< Front is most recently used.
+        qint64 m_budget = 64 * 1024 * 1024;
+        Stats m_stats;
+    };
+} // namespace nodeeditor::core::view
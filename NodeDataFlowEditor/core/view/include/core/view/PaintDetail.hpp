@@ -0,0 +1,70 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Detail level items paint at during the current paint.
+     *
+     * GraphView lowers it while a progressive pass refines a viewport, see
+     * GraphView::setProgressiveRenderingEnabled. Outside such a pass it is
+     * always @ref Full, so off-screen renders (snapshots, rasterizer jobs)
+     * are never affected.
+     *
+     * GUI thread only.
+     */
+    class PaintDetail
+    {
+    public:
+        enum Level : std::uint8_t
+        {
+            Bounds, ///< Nodes as flat rects; no edges, labels or rows.
+            Bodies, ///< Cached node bodies; no edges, labels or rows.
+            Full,
+        };
+
+        static Level current();
+
+        /** @brief Set the level for the lifetime of the scope, restoring the previous one after. */
+        class Scope
+        {
+        public:
+            explicit Scope(Level level);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            Level m_previous;
+        };
+
+    private:
+        static Level s_current;
+    };
+} // namespace nodeeditor::core::view
@@ -0,0 +1,164 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "mvp/utility/Signal.hpp"
+#include <QGraphicsItem>
+#include <QSizeF>
+#include <QVariant>
+#include <cstdint>
+
+class QGraphicsProxyWidget;
+class QWidget;
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Parameter editor painted directly by the item.
+     *
+     * Controls draw their value with QPainter and handle simple interaction
+     * (click, drag) themselves. A real QWidget is only created, inside a
+     * QGraphicsProxyWidget, while the user types into the control, and is
+     * destroyed again once editing ends.
+     */
+    class ParameterControl : public QGraphicsItem
+    {
+    public:
+        static constexpr qreal DefaultWidth = 120.0;
+        static constexpr qreal DefaultHeight = 22.0;
+
+        explicit ParameterControl(const QVariant& value, QGraphicsItem* parent = nullptr);
+        ~ParameterControl() override;
+
+        QRectF boundingRect() const override;
+        void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
+
+        void setSize(const QSizeF& size);
+        QSizeF size() const;
+
+        /** @brief Registry type this control was created for (0 when built directly). */
+        std::uint32_t typeId() const;
+        void setTypeId(std::uint32_t id);
+
+        /** @brief New unparented control with the same kind, settings and value. */
+        virtual ParameterControl* clone() const = 0;
+
+        const QVariant& value() const;
+        /** @brief Sets the value and emits @ref value_changed when it differs. */
+        void setValue(const QVariant& value);
+
+        /** @brief Emitted whenever the user or code changes the value. */
+        base::mvp::utility::Signal<const QVariant&> value_changed;
+
+        /** @brief Swap in the real editor widget, if the control has one. */
+        void beginEdit();
+        /** @brief Read back and destroy the editor widget. */
+        void endEdit();
+        bool isEditing() const;
+
+    protected:
+        /** @brief Create the focused editor, or nullptr when the control is paint-only. */
+        virtual QWidget* createEditor();
+        /** @brief Value to commit from @p editor when editing ends. */
+        virtual QVariant editorValue(QWidget* editor) const;
+        /** @brief Draw the value inside the frame. */
+        virtual void paintValue(QPainter& painter, const QRectF& rect) const = 0;
+
+        void mouseDoubleClickEvent(QGraphicsSceneMouseEvent* event) override;
+
+        QVariant m_value;
+
+    private:
+        QSizeF m_size{DefaultWidth, DefaultHeight};
+        std::uint32_t m_typeId = 0;
+        QWidget* m_editor = nullptr;
+        QGraphicsProxyWidget* m_editorProxy = nullptr;
+    };
+
+    /** @brief Checkbox drawn as a box with a tick; toggled by a click, no editor widget. */
+    class ToggleParameterControl : public ParameterControl
+    {
+    public:
+        explicit ToggleParameterControl(bool checked = false, QGraphicsItem* parent = nullptr);
+        ParameterControl* clone() const override;
+
+    protected:
+        void paintValue(QPainter& painter, const QRectF& rect) const override;
+        void mousePressEvent(QGraphicsSceneMouseEvent* event) override;
+        void mouseDoubleClickEvent(QGraphicsSceneMouseEvent* event) override;
+    };
+
+    /**
+     * @brief Numeric field changed by dragging horizontally.
+     *
+     * Each pixel of drag adds one step (a tenth with Shift). Double-click
+     * opens a spin box for typing an exact value.
+     */
+    class NumberParameterControl : public ParameterControl
+    {
+    public:
+        explicit NumberParameterControl(bool integer, QGraphicsItem* parent = nullptr);
+
+        ParameterControl* clone() const override;
+
+        void setRange(double minimum, double maximum);
+        void setStep(double step);
+        bool isInteger() const;
+
+    protected:
+        QWidget* createEditor() override;
+        QVariant editorValue(QWidget* editor) const override;
+        void paintValue(QPainter& painter, const QRectF& rect) const override;
+
+        void mousePressEvent(QGraphicsSceneMouseEvent* event) override;
+        void mouseMoveEvent(QGraphicsSceneMouseEvent* event) override;
+        void mouseReleaseEvent(QGraphicsSceneMouseEvent* event) override;
+
+    private:
+        double clamp(double v) const;
+
+        bool m_integer;
+        double m_minimum;
+        double m_maximum;
+        double m_step = 1.0;
+
+        qreal m_dragStartX = 0.;
+        double m_dragStartValue = 0.;
+    };
+
+    /** @brief Text field painted as elided text; a click opens a line edit. */
+    class TextParameterControl : public ParameterControl
+    {
+    public:
+        explicit TextParameterControl(const QString& text = QString(), QGraphicsItem* parent = nullptr);
+        ParameterControl* clone() const override;
+
+    protected:
+        QWidget* createEditor() override;
+        QVariant editorValue(QWidget* editor) const override;
+        void paintValue(QPainter& painter, const QRectF& rect) const override;
+        void mousePressEvent(QGraphicsSceneMouseEvent* event) override;
+    };
+} // namespace nodeeditor::core::view
@@ -0,0 +1,130 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QVariant>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class QWidget;
+
+namespace nodeeditor::core::view
+{
+    class ParameterControl;
+
+    /**
+     * @class ParameterTypeRegistry
+     * @brief Maps parameter type names to the factories that build them.
+     *
+     * Type names are interned once into small integer ids, so creating a
+     * parameter is a single hash lookup followed by indexed access instead of
+     * a chain of string comparisons. Each type provides a default value for
+     * storage, a painted control and, optionally, an editor widget. A
+     * prototype control can be registered instead of a factory; new controls
+     * are then cloned from it.
+     *
+     * Built-in types ("QString"/"string", "bool", "int", "double"/"float") are
+     * registered on first use.
+     *
+     * Example:
+     * @code
+     * ParameterTypeRegistry::registerType("percent", {
+     *     [] { return QVariant(50); },
+     *     [] { auto* c = new NumberParameterControl(true); c->setRange(0, 100); return c; },
+     *     nullptr});
+     * @endcode
+     */
+    class ParameterTypeRegistry
+    {
+    public:
+        using TypeId = std::uint32_t;
+
+        /** @brief Id returned for unknown names. */
+        static constexpr TypeId InvalidType = 0;
+
+        /** @brief Factories describing one parameter type. Any of them may be empty. */
+        struct Factories
+        {
+            std::function<QVariant()> makeStorage;
+            std::function<ParameterControl*()> makeControl;
+            std::function<QWidget*()> makeEditor;
+        };
+
+        /** @brief Returns the id of @p name, allocating one if it is new. */
+        static TypeId intern(const std::string& name);
+
+        /** @brief Returns the id of @p name, or InvalidType when it was never interned. */
+        static TypeId typeId(const std::string& name);
+
+        /**
+         * @brief Registers (or replaces) the factories of @p name and returns its id.
+         *
+         * Replacing a built-in type drops its prototype, so the new factories are used.
+         */
+        static TypeId registerType(const std::string& name, Factories factories);
+
+        /** @brief Makes @p alias resolve to the same id as @p name. */
+        static TypeId registerAlias(const std::string& alias, const std::string& name);
+
+        /**
+         * @brief Controls of @p id are cloned from @p prototype from now on.
+         * @note The registry keeps the prototype; it is never shown in a scene.
+         */
+        static void setPrototype(TypeId id, std::unique_ptr<ParameterControl> prototype);
+
+        static bool isRegistered(TypeId id);
+
+        /** @brief Default value for model-side storage of @p id. */
+        static QVariant createStorage(TypeId id);
+
+        /** @brief New painted control for @p id, or nullptr if the type has none. */
+        static ParameterControl* createControl(TypeId id);
+
+        /** @brief New editor widget for @p id, or nullptr if the type has none. */
+        static QWidget* createEditor(TypeId id);
+
+    private:
+        struct Entry
+        {
+            Factories factories;
+            std::shared_ptr<ParameterControl> prototype;
+            bool registered = false;
+        };
+
+        static void ensureBuiltins();
+        static Entry* entry(TypeId id);
+
+        /** @brief Maps names and aliases to interned ids. */
+        static inline std::unordered_map<std::string, TypeId> nameToId;
+
+        /** @brief Entries indexed by id; slot 0 is InvalidType. */
+        static inline std::vector<Entry> entries{Entry()};
+    };
+
+} // namespace nodeeditor::core::view
@@ -77,6 +77,21 @@ namespace nodeeditor::core::view
          * @brief Destructor.
          */
         ~PortItemView() override;
+
+        /**
+         * @brief Drop connections, tags and edit state before the view is pooled.
+         * @see ViewPool
+         */
+        void recycle();
+
+        /**
+         * @brief Re-initialize a pooled view; same arguments as the main constructor.
+         */
+        void resetForReuse(QString name,
+                           QString displayName,
+                           QString moduleName,
+                           common::utility::SPort::Orientation orientation = common::utility::SPort::Orientation::Output,
+                           QGraphicsItem* parent = nullptr);
         ///@}
 
         /** @name QGraphicsItem Overrides */
@@ -159,6 +174,12 @@ namespace nodeeditor::core::view
          * @return QString Module name
          */
         QString moduleName() const;
+
+        /**
+         * @brief Whether the label's inline editor is open.
+         * @return true while the display name is being edited
+         */
+        bool isEditing() const;
         ///@}
 
         /** @name Connections */
@@ -0,0 +1,188 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "common/taggable/TagRegistry.hpp"
+#include "core/view/TextLayoutCache.hpp"
+#include <QColor>
+#include <QHash>
+#include <QRectF>
+#include <QSet>
+#include <QString>
+#include <QVector>
+
+class QPainter;
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Compact, item-less storage for a node's port rows.
+     *
+     * Rows are plain values (names, colour and a shared text layout) painted
+     * by the owning NodeItemView. Geometry is uniform, so hit-testing and
+     * exposed-row culling are simple arithmetic on the row pitch.
+     *
+     * With a row limit set, each column shows a scrollable window of rows.
+     * Rows scrolled out of view collapse onto an aggregate anchor strip above
+     * or below the window, which is where their connections attach.
+     */
+    class PortTable
+    {
+    public:
+        enum class Side
+        {
+            Input,
+            Output
+        };
+
+        struct Row
+        {
+            QString name;
+            QString displayName;
+            TextLayoutCache::Layout layout;
+            QRgb color = 0;
+            int links = 0; ///< Connections attached to this row.
+            common::taggable::TagBitMask tags; ///< Compatibility tags, as on PortItemView.
+        };
+
+        /** @brief Height of the collapsed anchor strips around a scrolled window. */
+        static constexpr qreal AnchorStripHeight = 14.0;
+
+        /** @brief Identifies one row; invalid when index < 0. */
+        struct RowRef
+        {
+            Side side = Side::Input;
+            int index = -1;
+
+            bool isValid() const { return index >= 0; }
+            bool operator==(const RowRef& other) const { return side == other.side && index == other.index; }
+            bool operator!=(const RowRef& other) const { return !(*this == other); }
+        };
+
+        /** @brief Append a row and return its index. */
+        int append(Side side, const QString& name, const QString& displayName, const QColor& color = Qt::gray);
+
+        /** @brief Remove the row named @p name; returns false if absent. */
+        bool remove(Side side, const QString& name);
+
+        void clear();
+
+        /** @brief O(1) lookup through the per-side name index. */
+        RowRef find(Side side, const QString& name) const;
+        const Row& row(const RowRef& ref) const;
+        void setDisplayName(const RowRef& ref, const QString& displayName);
+        void setTags(const RowRef& ref, const common::taggable::TagBitMask& tags);
+
+        /** @brief Adjust the connection count of a row by @p delta. */
+        void addLinks(const RowRef& ref, int delta);
+
+        /** @name Virtualization */
+        ///@{
+        /** @brief Show at most @p rows rows per column; 0 shows every row. */
+        void setMaxVisibleRows(int rows);
+        int maxVisibleRows() const;
+
+        /** @brief First visible row index, shared by both columns and clamped per column. */
+        void setScrollOffset(int firstRow);
+        int scrollOffset() const;
+        int maxScrollOffset() const;
+
+        /** @brief True if @p side has more rows than fit in its window. */
+        bool isVirtualized(Side side) const;
+        bool isRowVisible(const RowRef& ref) const;
+        ///@}
+        int count(Side side) const;
+        bool isEmpty() const;
+
+        /** @brief Height of a single row (label height). */
+        qreal rowHeight() const;
+        /** @brief Widest row on @p side, arrow included. */
+        qreal maxWidth(Side side) const;
+
+        /**
+         * @brief Place the columns in node-local coordinates.
+         * @param inputTopLeft Top-left corner of the first input row.
+         * @param outputTopRight Top-right corner of the first output row; rows are right-aligned.
+         * @param pitch Distance between consecutive row tops.
+         */
+        void setGeometry(const QPointF& inputTopLeft, const QPointF& outputTopRight, qreal pitch);
+
+        /** @brief Total height taken by the rows on @p side. */
+        qreal columnHeight(Side side) const;
+
+        /** @brief Height the rows on @p side would take at @p pitch, before setGeometry() applies it. */
+        qreal columnHeight(Side side, qreal pitch) const;
+
+        /**
+         * @brief Node-local rect of a row.
+         *
+         * For a row scrolled out of view this is the aggregate anchor strip
+         * on the side it was scrolled to, so attached edges stay meaningful.
+         */
+        QRectF rowRect(const RowRef& ref) const;
+
+        /** @brief Visible row under @p localPos, or an invalid ref. */
+        RowRef hitTest(const QPointF& localPos) const;
+
+        /**
+         * @brief Paint the rows intersecting @p exposed.
+         * @param skip Row currently materialized as a real item, left to that item.
+         */
+        void paint(QPainter& painter, const QRectF& exposed, const RowRef& skip = RowRef()) const;
+
+    private:
+        QVector<Row>& rows(Side side);
+        const QVector<Row>& rows(Side side) const;
+        qreal rowWidth(const Row& row) const;
+        void refreshMaxWidth(Side side);
+        void reindex(Side side, int from);
+        void paintColumn(QPainter& painter, const QRectF& exposed, Side side, const RowRef& skip) const;
+        void paintAnchorStrip(QPainter& painter, Side side, const QRectF& strip, int hidden, int hiddenLinks) const;
+
+        int firstVisible(Side side) const;
+        int visibleCount(Side side) const;
+        qreal columnTop(Side side) const;
+        qreal columnX(Side side, qreal width) const;
+        QRectF anchorStrip(Side side, bool below) const;
+
+        QVector<Row> m_inputs;
+        QVector<Row> m_outputs;
+        QHash<QString, int> m_inputIndex;
+        QHash<QString, int> m_outputIndex;
+        QSet<int> m_linkedInputs;
+        QSet<int> m_linkedOutputs;
+
+        qreal m_rowHeight = 0.;
+        qreal m_maxInputWidth = 0.;
+        qreal m_maxOutputWidth = 0.;
+
+        QPointF m_inputTopLeft;
+        QPointF m_outputTopRight;
+        qreal m_pitch = 0.;
+
+        int m_maxVisibleRows = 0;
+        int m_scrollOffset = 0;
+    };
+} // namespace nodeeditor::core::view
@@ -0,0 +1,82 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "mvp/utility/Signal.hpp"
+#include <QString>
+#include <cstdint>
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Process-wide rendering quality, lowered one step at a time under load.
+     *
+     * Each level keeps every saving of the levels above it. Items read the
+     * flags while painting; GraphView's frame governor moves the level, see
+     * GraphView::setFrameGovernorEnabled.
+     *
+     * GUI thread only.
+     */
+    class RenderQuality
+    {
+    public:
+        enum Level : std::uint8_t
+        {
+            Full,
+            NoEdgeAntialiasing, ///< Edges drawn aliased.
+            NoFlowAnimation,    ///< Active edges stop animating their flow dots.
+            NoPortLabels,       ///< Port and row labels left out; arrows stay.
+            StraightEdges,      ///< Edges drawn as lines between their ends.
+        };
+
+        static constexpr Level Lowest = StraightEdges;
+
+        static RenderQuality& instance();
+
+        /**
+         * @brief Switch to @p level.
+         * @param reason Why, in words fit for a log line.
+         */
+        void setLevel(Level level, const QString& reason);
+        Level level() const;
+        const QString& reason() const;
+
+        bool edgeAntialiasing() const { return m_level < NoEdgeAntialiasing; }
+        bool flowAnimation() const { return m_level < NoFlowAnimation; }
+        bool portLabels() const { return m_level < NoPortLabels; }
+        bool curvedEdges() const { return m_level < StraightEdges; }
+
+        static const char* levelName(Level level);
+
+        /** @brief Emitted after a level change, with the new level. */
+        base::mvp::utility::Signal<Level> level_changed;
+
+    private:
+        RenderQuality() = default;
+
+        Level m_level = Full;
+        QString m_reason;
+    };
+} // namespace nodeeditor::core::view
@@ -0,0 +1,113 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Selection state as a bitset over dense item indices.
+     *
+     * Owners hand out an index per selectable item with @ref acquire and map it
+     * back to the item themselves. Bulk operations touch 64 items per word and
+     * report what changed as a single @ref Delta, so the owner can apply and
+     * announce a rubber band over thousands of items in one go.
+     *
+     * Released indices are reused; a released index is never selected.
+     */
+    class SelectionSet
+    {
+    public:
+        using Index = std::uint32_t;
+
+        /** @brief Indices whose state flipped during one operation, in ascending order. */
+        struct Delta
+        {
+            std::vector<Index> selected;
+            std::vector<Index> deselected;
+
+            bool isEmpty() const { return selected.empty() && deselected.empty(); }
+        };
+
+        /** @brief Reserve an index for a new item; it starts deselected. */
+        Index acquire();
+
+        /** @brief Give an index back. Its selection is dropped without a delta. */
+        void release(Index index);
+
+        bool isLive(Index index) const;
+        bool isSelected(Index index) const;
+
+        /** @brief Number of selected indices. */
+        std::size_t count() const;
+
+        /** @brief Number of live indices. */
+        std::size_t size() const;
+
+        /** @brief One past the highest index ever handed out. */
+        std::size_t capacity() const;
+
+        Delta select(Index index, bool selected = true);
+
+        /** @brief Select exactly @p indices; everything else is deselected. */
+        Delta assign(const std::vector<Index>& indices);
+
+        /** @brief Add @p indices to the selection. */
+        Delta add(const std::vector<Index>& indices);
+
+        Delta selectAll();
+        Delta invert();
+        Delta clear();
+
+        /** @brief Visit every selected index in ascending order. */
+        template <typename Fn>
+        void forEachSelected(Fn&& fn) const
+        {
+            for (std::size_t w = 0; w < m_bits.size(); ++w)
+                for (Word bits = m_bits[w]; bits; bits &= bits - 1)
+                    fn(Index(w * WordBits + lowestBit(bits)));
+        }
+
+    private:
+        using Word = std::uint64_t;
+        static constexpr std::size_t WordBits = 64;
+
+        static int lowestBit(Word word);
+
+        /** @brief Replace the bits and collect the flipped indices. */
+        Delta commit(std::vector<Word> next);
+
+        void setBit(std::vector<Word>& words, Index index, bool on) const;
+
+        std::vector<Word> m_bits;  ///< Selected indices.
+        std::vector<Word> m_live;  ///< Acquired indices.
+        std::vector<Index> m_free; ///< Released indices, reused first.
+        std::size_t m_capacity = 0;
+        std::size_t m_count = 0;
+    };
+} // namespace nodeeditor::core::view
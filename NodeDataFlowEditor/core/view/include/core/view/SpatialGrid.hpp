@@ -0,0 +1,267 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QRectF>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Uniform hash grid indexing values by their scene-space bounds.
+     *
+     * Each value is bucketed into every cell its bounds overlap. Values whose
+     * bounds span more than @ref MaxCellsPerEntry cells are kept in a separate
+     * oversized list that every query scans, so long edges do not flood the grid.
+     *
+     * Updates are incremental: moving a value only touches the cells it leaves
+     * and enters. Queries visit each matching value exactly once.
+     *
+     * @tparam T Hashable value type (typically a pointer or an id).
+     */
+    template <typename T>
+    class SpatialGrid
+    {
+    public:
+        static constexpr int MaxCellsPerEntry = 64; ///< Above this, the entry is stored as oversized.
+
+        /**
+         * @brief Construct an empty grid.
+         * @param cellSize Edge length of one cell in scene units.
+         */
+        explicit SpatialGrid(qreal cellSize = 256.0)
+            : m_cellSize(cellSize > 0.0 ? cellSize : 256.0)
+        {}
+
+        /**
+         * @brief Insert a value, or move it if already present.
+         * @param value The value to index.
+         * @param bounds Its bounds in scene coordinates.
+         */
+        void insert(const T& value, const QRectF& bounds)
+        {
+            auto it = m_entries.find(value);
+            if (it != m_entries.end())
+            {
+                relocate(it->second, bounds);
+                return;
+            }
+
+            auto& entry = m_entries[value];
+            entry.value = value;
+            attach(entry, bounds);
+        }
+
+        /**
+         * @brief Remove a value from the grid. Does nothing if absent.
+         */
+        void remove(const T& value)
+        {
+            auto it = m_entries.find(value);
+            if (it == m_entries.end())
+                return;
+            detach(it->second);
+            m_entries.erase(it);
+        }
+
+        /** @brief Check whether a value is indexed. */
+        bool contains(const T& value) const
+        {
+            return m_entries.find(value) != m_entries.end();
+        }
+
+        /** @brief Indexed bounds of a value, or a null rect if absent. */
+        QRectF bounds(const T& value) const
+        {
+            auto it = m_entries.find(value);
+            return it != m_entries.end() ? it->second.bounds : QRectF();
+        }
+
+        /**
+         * @brief Visit every value whose bounds intersect @p rect.
+         * @param rect Query rectangle in scene coordinates.
+         * @param fn Callable invoked as fn(const T& value, const QRectF& bounds).
+         */
+        template <typename Fn>
+        void query(const QRectF& rect, Fn&& fn) const
+        {
+            const QRectF area = rect.normalized();
+            const quint32 stamp = ++m_stamp;
+            auto visit = [&](Entry* e) {
+                if (e->stamp == stamp)
+                    return;
+                e->stamp = stamp;
+                if (overlaps(e->bounds, area))
+                    fn(static_cast<const T&>(e->value), static_cast<const QRectF&>(e->bounds));
+            };
+
+            int x0, y0, x1, y1;
+            cellRange(area, x0, y0, x1, y1);
+            const qint64 cellCount = qint64(x1 - x0 + 1) * qint64(y1 - y0 + 1);
+
+            if (cellCount > qint64(m_cells.size()))
+            {
+                // Query covers more cells than are populated: walk the populated ones.
+                for (const auto& [key, cell] : m_cells)
+                    for (Entry* e : cell)
+                        visit(e);
+            }
+            else
+            {
+                for (int cy = y0; cy <= y1; ++cy)
+                    for (int cx = x0; cx <= x1; ++cx)
+                    {
+                        auto cit = m_cells.find(cellKey(cx, cy));
+                        if (cit == m_cells.end())
+                            continue;
+                        for (Entry* e : cit->second)
+                            visit(e);
+                    }
+            }
+
+            for (Entry* e : m_oversized)
+                visit(e);
+        }
+
+        /** @brief Remove every value. */
+        void clear()
+        {
+            m_cells.clear();
+            m_oversized.clear();
+            m_entries.clear();
+        }
+
+        /** @brief Number of indexed values. */
+        std::size_t size() const { return m_entries.size(); }
+
+        /** @brief Edge length of one cell in scene units. */
+        qreal cellSize() const { return m_cellSize; }
+
+    private:
+        struct Entry
+        {
+            T value{};
+            QRectF bounds;
+            int x0 = 0, y0 = 0, x1 = -1, y1 = -1;
+            bool oversized = false;
+            mutable quint32 stamp = 0;
+        };
+
+        /** Closed-interval overlap, so zero-sized bounds (points) still match. */
+        static bool overlaps(const QRectF& a, const QRectF& b)
+        {
+            return a.left() <= b.right() && b.left() <= a.right() &&
+                   a.top() <= b.bottom() && b.top() <= a.bottom();
+        }
+
+        static quint64 cellKey(int cx, int cy)
+        {
+            return (quint64(quint32(cx)) << 32) | quint64(quint32(cy));
+        }
+
+        void cellRange(const QRectF& r, int& x0, int& y0, int& x1, int& y1) const
+        {
+            const QRectF n = r.normalized();
+            x0 = int(std::floor(n.left() / m_cellSize));
+            y0 = int(std::floor(n.top() / m_cellSize));
+            x1 = int(std::floor(n.right() / m_cellSize));
+            y1 = int(std::floor(n.bottom() / m_cellSize));
+        }
+
+        void attach(Entry& e, const QRectF& bounds)
+        {
+            e.bounds = bounds.normalized();
+            cellRange(e.bounds, e.x0, e.y0, e.x1, e.y1);
+            const qint64 count = qint64(e.x1 - e.x0 + 1) * qint64(e.y1 - e.y0 + 1);
+            e.oversized = count > MaxCellsPerEntry;
+
+            if (e.oversized)
+            {
+                m_oversized.push_back(&e);
+                return;
+            }
+            for (int cy = e.y0; cy <= e.y1; ++cy)
+                for (int cx = e.x0; cx <= e.x1; ++cx)
+                    m_cells[cellKey(cx, cy)].push_back(&e);
+        }
+
+        void detach(Entry& e)
+        {
+            if (e.oversized)
+            {
+                eraseFrom(m_oversized, &e);
+                return;
+            }
+            for (int cy = e.y0; cy <= e.y1; ++cy)
+                for (int cx = e.x0; cx <= e.x1; ++cx)
+                {
+                    auto cit = m_cells.find(cellKey(cx, cy));
+                    if (cit == m_cells.end())
+                        continue;
+                    eraseFrom(cit->second, &e);
+                    if (cit->second.empty())
+                        m_cells.erase(cit);
+                }
+        }
+
+        void relocate(Entry& e, const QRectF& bounds)
+        {
+            const QRectF n = bounds.normalized();
+            int x0, y0, x1, y1;
+            cellRange(n, x0, y0, x1, y1);
+            if (!e.oversized && x0 == e.x0 && y0 == e.y0 && x1 == e.x1 && y1 == e.y1)
+            {
+                // Same cells: only the stored bounds change.
+                e.bounds = n;
+                return;
+            }
+            detach(e);
+            attach(e, n);
+        }
+
+        static void eraseFrom(std::vector<Entry*>& list, Entry* e)
+        {
+            for (std::size_t i = 0; i < list.size(); ++i)
+            {
+                if (list[i] == e)
+                {
+                    list[i] = list.back();
+                    list.pop_back();
+                    return;
+                }
+            }
+        }
+
+    private:
+        qreal m_cellSize;
+        std::unordered_map<T, Entry> m_entries; ///< Node-based: entry addresses stay stable.
+        std::unordered_map<quint64, std::vector<Entry*>> m_cells;
+        std::vector<Entry*> m_oversized;
+        mutable quint32 m_stamp = 0;
+    };
+} // namespace nodeeditor::core::view
@@ -0,0 +1,155 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "common/taggable/TagRegistry.hpp"
+#include "core/view/PortTable.hpp"
+#include "core/view/SpatialGrid.hpp"
+#include <QPointF>
+#include <QRectF>
+#include <QString>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace nodeeditor::core::view
+{
+    class ConnectionPathView;
+    class NodeItemView;
+
+    /**
+     * @brief Typed spatial queries over the nodes, ports and edges of a scene.
+     *
+     * Three SpatialGrid instances index node bounds, port rects (item ports and
+     * painted rows alike, with their tag masks) and edge hulls. The owner keeps the index current:
+     * @ref moveNode on every node move shifts the node and its port rects by the
+     * delta, @ref refreshNode re-reads them after a re-layout, and edges follow
+     * their own path_changed signal.
+     *
+     * Unlike QGraphicsScene::items(), queries never touch Qt's BSP tree and return
+     * only the item kinds asked for.
+     */
+    class SpatialIndex
+    {
+    public:
+        /** @brief A port near a query point. */
+        struct PortHit
+        {
+            NodeItemView* node = nullptr;
+            PortTable::Side side = PortTable::Side::Input;
+            QString name;
+            QRectF rect;         ///< Scene rect of the port or row.
+            QPointF anchor;      ///< Centre of @ref rect.
+            qreal distance = 0.; ///< Distance from the query point to @ref rect (0 inside).
+            common::taggable::TagBitMask tags;
+        };
+
+        SpatialIndex();
+        ~SpatialIndex();
+
+        SpatialIndex(const SpatialIndex&) = delete;
+        SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+        /** @name Maintenance */
+        ///@{
+        void addNode(NodeItemView* node);
+        void removeNode(NodeItemView* node);
+        /** @brief Re-read the bounds, port rects and port tags of @p node. */
+        void refreshNode(NodeItemView* node);
+        /** @brief Shift @p node and its port rects by a scene-space @p delta. */
+        void moveNode(NodeItemView* node, const QPointF& delta);
+
+        void addEdge(ConnectionPathView* edge);
+        void removeEdge(ConnectionPathView* edge);
+        void clear();
+        ///@}
+
+        /** @name Queries */
+        ///@{
+        /** @brief Nodes whose bounds intersect @p rect. */
+        std::vector<NodeItemView*> nodesIn(const QRectF& rect) const;
+
+        /** @brief Node with the highest z-value whose bounds contain @p point, or nullptr. */
+        NodeItemView* nodeAt(const QPointF& point) const;
+
+        /** @brief Ports within @p radius of @p point, nearest first. */
+        std::vector<PortHit> portsWithin(const QPointF& point, qreal radius) const;
+
+        /**
+         * @brief Nearest port that @p source may connect to.
+         *
+         * A candidate must sit on another node, on the opposite side, and pass
+         * @ref tagsCompatible. Only ports within @p radius of @p point are tried.
+         */
+        std::optional<PortHit> nearestCompatiblePort(const QPointF& point, const PortHit& source, qreal radius) const;
+
+        /** @brief Untagged ports accept anything; tagged ones need one tag in common. */
+        static bool tagsCompatible(const common::taggable::TagBitMask& a, const common::taggable::TagBitMask& b);
+
+        /**
+         * @brief Edge whose curve passes closest to @p point.
+         * @param maxDistance Edges farther than this are ignored.
+         * @param distance Optional out: distance to the returned edge.
+         */
+        ConnectionPathView* nearestEdge(const QPointF& point, qreal maxDistance = 8.0, qreal* distance = nullptr) const;
+
+        /** @brief Edges whose bounds intersect @p rect. */
+        std::vector<ConnectionPathView*> edgesIn(const QRectF& rect) const;
+        ///@}
+
+        std::size_t nodeCount() const;
+        std::size_t portCount() const;
+        std::size_t edgeCount() const;
+
+    private:
+        struct PortEntry
+        {
+            NodeItemView* node = nullptr;
+            PortTable::Side side = PortTable::Side::Input;
+            QString name;
+            QRectF rect;
+            common::taggable::TagBitMask tags;
+        };
+
+        void addPort(NodeItemView* node, PortTable::Side side, const QString& name, const QRectF& sceneRect,
+                     const common::taggable::TagBitMask& tags);
+        PortHit makeHit(const PortEntry& entry, const QPointF& point) const;
+        void removePorts(NodeItemView* node);
+        void refreshEdge(ConnectionPathView* edge);
+
+        /** @brief Distance from @p point to the flattened curve of @p edge. */
+        static qreal distanceToEdge(const ConnectionPathView* edge, const QPointF& point);
+
+        SpatialGrid<NodeItemView*> m_nodes{512.0};
+        SpatialGrid<std::uint64_t> m_ports{128.0};
+        SpatialGrid<ConnectionPathView*> m_edges{512.0};
+
+        std::unordered_map<std::uint64_t, PortEntry> m_portEntries;
+        std::unordered_map<NodeItemView*, std::vector<std::uint64_t>> m_nodePorts;
+        std::unordered_map<ConnectionPathView*, std::size_t> m_edgeSlots; ///< path_changed slot per edge.
+        std::uint64_t m_nextPortId = 1;
+    };
+} // namespace nodeeditor::core::view
@@ -0,0 +1,95 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QFont>
+#include <QHash>
+#include <QSizeF>
+#include <QStaticText>
+#include <QString>
+#include <list>
+
+class QPainter;
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Process-wide cache of shaped label text keyed by (text, font).
+     *
+     * Identical labels such as "input1" share one QStaticText and one set of
+     * metrics, so layout is done once instead of per QTextDocument. Past
+     * @ref MaxEntries the least recently used layouts are evicted; labels
+     * keep their own copy, so eviction only costs a re-shape on next use.
+     */
+    class TextLayoutCache
+    {
+    public:
+        /** @brief Shaped text and its padded size. */
+        struct Layout
+        {
+            QStaticText text;
+            QSizeF size; ///< Text extent plus Margin on every side.
+        };
+
+        /** @brief Padding around the text, matching QGraphicsTextItem's document margin. */
+        static constexpr qreal Margin = 4.0;
+
+        /** @brief Entries kept before the least recently used ones are evicted. */
+        static constexpr int MaxEntries = 4096;
+
+        static TextLayoutCache& instance();
+
+        /**
+         * @brief Layout for @p text in @p font, shaping it on first use.
+         * @note GUI thread only.
+         */
+        Layout layout(const QString& text, const QFont& font);
+
+        /** @brief Draw @p layout with its top-left margin corner at @p topLeft. */
+        static void draw(QPainter& painter, const QPointF& topLeft, const Layout& layout);
+
+        void clear();
+        int size() const;
+
+        quint64 hits() const;
+        quint64 misses() const;
+        quint64 evictions() const;
+
+    private:
+        TextLayoutCache() = default;
+
+        struct Entry
+        {
+            Layout layout;
+            std::list<QString>::iterator lru;
+        };
+
+        QHash<QString, Entry> m_layouts;
+        std::list<QString> m_lru; ///< Front is most recently used.
+        quint64 m_hits = 0;
+        quint64 m_misses = 0;
+        quint64 m_evictions = 0;
+    };
+} // namespace nodeeditor::core::view
@@ -0,0 +1,170 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QGraphicsItem>
+#include <QGraphicsScene>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Free list of released views of one type, reset and handed out again.
+     *
+     * acquire() returns a shared_ptr whose deleter gives the view back to the
+     * pool instead of destroying it: the view leaves its scene and parent, and
+     * T::recycle() drops its connections and transient state. A later acquire()
+     * calls T::resetForReuse() with the constructor arguments instead of
+     * constructing a new view. At most @ref highWaterMark views are kept; extra
+     * releases are deleted.
+     *
+     * Views released after the pool is gone are deleted normally. The pool
+     * does not delete its idle views on destruction; call clear() before the
+     * application shuts down.
+     *
+     * @tparam T A QGraphicsItem providing recycle() and resetForReuse(args...)
+     *           matching one of its constructors.
+     */
+    template <typename T>
+    class ViewPool
+    {
+    public:
+        static constexpr std::size_t DefaultHighWaterMark = 256;
+
+        /** @brief Counters for tuning the high-water mark. */
+        struct Stats
+        {
+            std::size_t hits = 0;      ///< acquire() served from the free list.
+            std::size_t misses = 0;    ///< acquire() had to construct a view.
+            std::size_t recycled = 0;  ///< Released views kept for reuse.
+            std::size_t discarded = 0; ///< Released views deleted because the pool was full.
+        };
+
+        static ViewPool& instance()
+        {
+            static ViewPool pool;
+            return pool;
+        }
+
+        ViewPool()
+            : m_state(std::make_shared<State>())
+        {}
+
+        /**
+         * @brief Leaves idle views alone: a static pool dies after QApplication.
+         *
+         * Owners call clear() while Qt is still up; views released afterwards
+         * find the pool gone and are deleted normally.
+         */
+        ~ViewPool() = default;
+
+        ViewPool(const ViewPool&) = delete;
+        ViewPool& operator=(const ViewPool&) = delete;
+
+        /** @brief A view built from @p args, reused from the free list when possible. */
+        template <typename... Args>
+        std::shared_ptr<T> acquire(Args&&... args)
+        {
+            T* view = nullptr;
+            if (!m_state->free.empty())
+            {
+                view = m_state->free.back();
+                m_state->free.pop_back();
+                view->resetForReuse(std::forward<Args>(args)...);
+                ++m_state->stats.hits;
+            }
+            else
+            {
+                view = new T(std::forward<Args>(args)...);
+                ++m_state->stats.misses;
+            }
+            return std::shared_ptr<T>(view, Recycler{m_state});
+        }
+
+        /** @brief Maximum number of idle views kept; lowering it trims the free list. */
+        void setHighWaterMark(std::size_t count)
+        {
+            m_state->highWaterMark = count;
+            while (m_state->free.size() > count)
+            {
+                delete m_state->free.back();
+                m_state->free.pop_back();
+            }
+        }
+
+        std::size_t highWaterMark() const { return m_state->highWaterMark; }
+
+        /** @brief Idle views currently held. */
+        std::size_t idleCount() const { return m_state->free.size(); }
+
+        const Stats& stats() const { return m_state->stats; }
+        void resetStats() { m_state->stats = Stats(); }
+
+        /** @brief Delete every idle view. */
+        void clear()
+        {
+            for (T* view : m_state->free)
+                delete view;
+            m_state->free.clear();
+        }
+
+    private:
+        struct State
+        {
+            std::vector<T*> free;
+            std::size_t highWaterMark = DefaultHighWaterMark;
+            Stats stats;
+        };
+
+        struct Recycler
+        {
+            std::weak_ptr<State> state;
+
+            void operator()(T* view) const
+            {
+                auto s = state.lock();
+                if (!s || s->free.size() >= s->highWaterMark)
+                {
+                    if (s)
+                        ++s->stats.discarded;
+                    delete view;
+                    return;
+                }
+
+                if (view->scene())
+                    view->scene()->removeItem(view);
+                view->setParentItem(nullptr);
+                view->recycle();
+                s->free.push_back(view);
+                ++s->stats.recycled;
+            }
+        };
+
+        std::shared_ptr<State> m_state;
+    };
+} // namespace nodeeditor::core::view
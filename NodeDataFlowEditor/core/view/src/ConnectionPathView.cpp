@@ -24,6 +24,8 @@
 
 #include "core/view/ConnectionPathView.hpp"
 #include "common/utility/ConnectionInfo.hpp"
+#include "core/view/PaintDetail.hpp"
+#include "core/view/RenderQuality.hpp"
 
 #include <QPainter>
 #include <QPainterPath>
@@ -31,6 +33,7 @@
 #include <QStyleOption>
 #include <QtMath>
 #include <qcoreevent.h>
+#include <utility>
 
 namespace nodeeditor::core::view
 {
@@ -64,6 +67,7 @@ namespace nodeeditor::core::view
             }
             update();
         });
+        watchQuality();
     }
 
     ConnectionPathView::ConnectionPathView(const ConnectionPortData& port1, const ConnectionPortData& port2, QGraphicsItem* parent)
@@ -89,6 +93,63 @@ namespace nodeeditor::core::view
     ConnectionPathView::~ConnectionPathView()
     {
         m_isDestroying = true;
+        EdgeGeometryBatch::instance().cancel(this);
+        unwatchQuality();
+    }
+
+    void
+    ConnectionPathView::recycle()
+    {
+        m_animationTimer.stop();
+        EdgeGeometryBatch::instance().cancel(this);
+        unwatchQuality();
+        resetViewConnections();
+
+        path_changed.disconnectAll();
+        inputPort_changed.disconnectAll();
+        outputPort_changed.disconnectAll();
+        endPoint_changed.disconnectAll();
+        active_changed.disconnectAll();
+        compatible_changed.disconnectAll();
+        input_changed.disconnectAll();
+        output_changed.disconnectAll();
+
+        onActiveChanged = nullptr;
+        onCompatibleChanged = nullptr;
+        onInputPortChanged = nullptr;
+        onOutputPortChanged = nullptr;
+        onEndPointChanged = nullptr;
+
+        active_ = false;
+        compatible_ = false;
+    }
+
+    void
+    ConnectionPathView::resetForReuse(const ConnectionPortData& port, QGraphicsItem* parent)
+    {
+        setParentItem(parent);
+        setVisible(true);
+        setOpacity(1.0);
+        setPen(QPen(Qt::red, 2));
+
+        m_inputPort = ConnectionPortData();
+        m_outputPort = ConnectionPortData();
+        m_endPoint = QPointF();
+        m_circlePositions = {0.0, 0.2, 0.4, 0.6, 0.8};
+        prepareGeometryChange();
+        m_curve = EdgeCurve();
+        m_currentPath = QPainterPath();
+        setPath(m_currentPath);
+
+        addPort(port);
+        watchQuality();
+    }
+
+    void
+    ConnectionPathView::resetForReuse(const ConnectionPortData& port1, const ConnectionPortData& port2, QGraphicsItem* parent)
+    {
+        resetForReuse(port1, parent);
+        addPort(port2);
     }
 
     void
@@ -129,12 +190,26 @@ namespace nodeeditor::core::view
     void
     ConnectionPathView::updateAnimationStatus()
     {
-        if (active_)
+        if (active_ && RenderQuality::instance().flowAnimation())
             m_animationTimer.start(30);
         else
             m_animationTimer.stop();
     }
 
+    void
+    ConnectionPathView::watchQuality()
+    {
+        if (!m_qualitySlot)
+            m_qualitySlot = RenderQuality::instance().level_changed.connect([this](RenderQuality::Level) { updateAnimationStatus(); });
+    }
+
+    void
+    ConnectionPathView::unwatchQuality()
+    {
+        if (m_qualitySlot)
+            RenderQuality::instance().level_changed.disconnect(*std::exchange(m_qualitySlot, std::nullopt));
+    }
+
     QPointF
     ConnectionPathView::computeInputPoint(const ConnectionPortData& port) const
     {
@@ -157,20 +232,31 @@ namespace nodeeditor::core::view
         if (startPoint.isNull() || endPoint.isNull())
             return;
 
+        applyCurve(EdgeGeometryBatch::curveFor(startPoint, endPoint));
+    }
+
+    void
+    ConnectionPathView::applyCurve(const EdgeCurve& curve)
+    {
+        prepareGeometryChange();
+
         if (compatible_ || (!m_inputPort.portName.isEmpty() && !m_outputPort.portName.isEmpty()))
             setPen(QPen(Qt::green, 2));
         else if (!compatible_)
             setPen(QPen(Qt::red, 2));
-        QPainterPath path(startPoint);
-        qreal dx = endPoint.x() - startPoint.x();
-        QPointF ctrl1 = startPoint + QPointF(dx * 0.25, 0);
-        QPointF ctrl2 = endPoint - QPointF(dx * 0.25, 0);
-        path.cubicTo(ctrl1, ctrl2, endPoint);
 
-        m_currentPath = path;
-        setPath(path);
+        m_curve = curve;
+        m_currentPath = curve.path;
+        setPath(m_currentPath);
 
         updateAnimationStatus();
+        path_changed.notify();
+    }
+
+    const EdgeCurve&
+    ConnectionPathView::curve() const
+    {
+        return m_curve;
     }
 
     void
@@ -188,6 +274,7 @@ namespace nodeeditor::core::view
         setPen(pen);
         set_compatible(newIsCompatible);
         update();
+        path_changed.notify();
     }
 
     bool
@@ -215,6 +302,15 @@ namespace nodeeditor::core::view
 
     void
     ConnectionPathView::updatePath()
+    {
+        QPointF startPoint;
+        QPointF endPoint;
+        if (curveEnds(&startPoint, &endPoint))
+            drawPath(startPoint, endPoint);
+    }
+
+    bool
+    ConnectionPathView::curveEnds(QPointF* start, QPointF* end) const
     {
         QPointF startPoint;
         QPointF endPoint;
@@ -230,12 +326,21 @@ namespace nodeeditor::core::view
             endPoint = computeInputPoint(m_outputPort);
         }
 
-        if (!startPoint.isNull() && !endPoint.isNull())
-            drawPath(startPoint, endPoint);
-        else if (!endPoint.isNull()) // no output yet
-            drawPath(endPoint, m_endPoint);
-        else if (!startPoint.isNull())
-            drawPath(startPoint, m_endPoint);
+        if (startPoint.isNull() && !endPoint.isNull()) // no output yet
+        {
+            startPoint = endPoint;
+            endPoint = m_endPoint;
+        }
+        else if (endPoint.isNull())
+        {
+            endPoint = m_endPoint;
+        }
+
+        if (startPoint.isNull() || endPoint.isNull() || startPoint == endPoint)
+            return false;
+        *start = startPoint;
+        *end = endPoint;
+        return true;
     }
 
     QPainterPath
@@ -246,6 +351,22 @@ namespace nodeeditor::core::view
         return stroker.createStroke(m_currentPath);
     }
 
+    QRectF
+    ConnectionPathView::boundingRect() const
+    {
+        if (m_currentPath.isEmpty())
+            return QRectF();
+        // Half the 10 px glow or the 5 px flow dots, plus antialiasing.
+        constexpr qreal margin = 6.0;
+        return m_curve.bounds.adjusted(-margin, -margin, margin, margin);
+    }
+
+    const QPainterPath&
+    ConnectionPathView::currentPath() const
+    {
+        return m_currentPath;
+    }
+
     void ConnectionPathView::set_inputPort(const common::utility::SPort& p)
     {
         if (m_inputPort.portName == p.name && m_inputPort.moduleName == p.nodeName && m_inputPort.isInput == p.input)
@@ -274,6 +395,42 @@ namespace nodeeditor::core::view
         updatePath();
     }
 
+    void ConnectionPathView::translateEnds(const QPointF& inputDelta, const QPointF& outputDelta)
+    {
+        if (inputDelta.isNull() && outputDelta.isNull())
+            return;
+        m_inputPort.scenePos += inputDelta;
+        m_outputPort.scenePos += outputDelta;
+        updatePath();
+    }
+
+    void ConnectionPathView::shiftEnds(const QPointF& inputDelta, const QPointF& outputDelta)
+    {
+        m_inputPort.scenePos += inputDelta;
+        m_outputPort.scenePos += outputDelta;
+    }
+
+    void ConnectionPathView::translateRigidly(const QPointF& delta)
+    {
+        if (delta.isNull())
+            return;
+        m_inputPort.scenePos += delta;
+        m_outputPort.scenePos += delta;
+        m_endPoint += delta;
+
+        prepareGeometryChange();
+        m_curve.start += delta;
+        m_curve.ctrl1 += delta;
+        m_curve.ctrl2 += delta;
+        m_curve.end += delta;
+        m_curve.bounds.translate(delta);
+        m_curve.polyline.translate(delta);
+        m_curve.path.translate(delta);
+        m_currentPath = m_curve.path;
+        setPath(m_currentPath);
+        path_changed.notify();
+    }
+
     void ConnectionPathView::set_outputPort(const common::utility::SPort& p)
     {
         if (m_outputPort.portName == p.name && m_outputPort.moduleName == p.nodeName && m_outputPort.isInput == p.input)
@@ -334,7 +491,19 @@ namespace nodeeditor::core::view
                               const QStyleOptionGraphicsItem* option,
                               QWidget*)
     {
-        painter->setRenderHint(QPainter::Antialiasing, true);
+        if (PaintDetail::current() != PaintDetail::Full)
+            return;
+
+        const RenderQuality& quality = RenderQuality::instance();
+        painter->setRenderHint(QPainter::Antialiasing, quality.edgeAntialiasing());
+
+        // The curve geometry (bounds, picking) is kept; only the stroke goes straight.
+        QPainterPath stroke = m_currentPath;
+        if (!quality.curvedEdges() && !m_curve.path.isEmpty())
+        {
+            stroke = QPainterPath(m_curve.start);
+            stroke.lineTo(m_curve.end);
+        }
 
         if (option->state & QStyle::State_Selected)
         {
@@ -343,22 +512,23 @@ namespace nodeeditor::core::view
             glowPen.setCapStyle(Qt::RoundCap);
             glowPen.setJoinStyle(Qt::RoundJoin);
             painter->setPen(glowPen);
-            painter->drawPath(m_currentPath);
+            painter->drawPath(stroke);
 
             QPen innerGlow(QColor(0, 180, 255, 255)); // stronger blue
             innerGlow.setWidth(6);
             innerGlow.setCapStyle(Qt::RoundCap);
             innerGlow.setJoinStyle(Qt::RoundJoin);
             painter->setPen(innerGlow);
-            painter->drawPath(m_currentPath);
+            painter->drawPath(stroke);
         }
         QPen normalPen = pen();
         normalPen.setCapStyle(Qt::RoundCap);
         normalPen.setJoinStyle(Qt::RoundJoin);
         painter->setPen(normalPen);
         painter->setBrush(Qt::NoBrush);
-        painter->drawPath(m_currentPath);
-        if (active_)
+        painter->drawPath(stroke);
+
+        if (active_ && quality.flowAnimation())
         {
             if (compatible_ || (!m_inputPort.portName.isEmpty() && !m_outputPort.portName.isEmpty()))
                 painter->setBrush(Qt::green);
@@ -368,7 +538,7 @@ namespace nodeeditor::core::view
 
             for (qreal t : std::as_const(m_circlePositions))
             {
-                QPointF pt = m_currentPath.pointAtPercent(t);
+                QPointF pt = stroke.pointAtPercent(t);
                 painter->drawEllipse(pt, 5, 5);
             }
         }
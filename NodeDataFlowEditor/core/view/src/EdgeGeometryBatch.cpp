@@ -0,0 +1,336 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/EdgeGeometryBatch.hpp"
+#include "core/view/ConnectionPathView.hpp"
+#include "core/view/FrameScheduler.hpp"
+
+#include <QElapsedTimer>
+#include <QRunnable>
+#include <QThread>
+#include <algorithm>
+#include <array>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NODEEDITOR_EDGE_SSE2 1
+#endif
+
+namespace nodeeditor::core::view
+{
+    namespace
+    {
+        constexpr int Samples = EdgeGeometryBatch::Segments + 1;
+        constexpr std::size_t ChunkSize = 1024;
+
+        /**
+         * @brief Bernstein weights per sample.
+         *
+         * Both control points share the y of their end point, so y only needs
+         * the two summed weights.
+         */
+        struct Basis
+        {
+            std::array<std::array<double, 4>, Samples> x;
+            std::array<std::array<double, 2>, Samples> y;
+        };
+
+        const Basis&
+        basis()
+        {
+            static const Basis table = [] {
+                Basis b{};
+                for (int s = 0; s < Samples; ++s)
+                {
+                    const double t = double(s) / EdgeGeometryBatch::Segments;
+                    const double u = 1.0 - t;
+                    b.x[s] = {u * u * u, 3 * u * u * t, 3 * u * t * t, t * t * t};
+                    b.y[s] = {b.x[s][0] + b.x[s][1], b.x[s][2] + b.x[s][3]};
+                }
+                return b;
+            }();
+            return table;
+        }
+
+        /** @brief Fill the Qt side of a curve from its evaluated coordinates. */
+        void
+        finish(EdgeCurve& curve, double x0, double y0, double c1x, double c2x, double x1, double y1,
+               const double* px, const double* py, std::size_t stride)
+        {
+            curve.start = QPointF(x0, y0);
+            curve.ctrl1 = QPointF(c1x, y0);
+            curve.ctrl2 = QPointF(c2x, y1);
+            curve.end = QPointF(x1, y1);
+
+            // Control x values are a quarter and three quarters of the way from x0 to x1,
+            // and control y values equal the end y values: both coordinates are monotonic,
+            // so the end points bound the whole curve.
+            curve.bounds = QRectF(QPointF(std::min(x0, x1), std::min(y0, y1)), QPointF(std::max(x0, x1), std::max(y0, y1)));
+
+            curve.polyline.resize(Samples);
+            for (int s = 0; s < Samples; ++s)
+                curve.polyline[s] = QPointF(px[s * stride], py[s * stride]);
+
+            curve.path = QPainterPath(curve.start);
+            curve.path.cubicTo(curve.ctrl1, curve.ctrl2, curve.end);
+        }
+
+        void
+        evaluateOne(double x0, double y0, double x1, double y1, EdgeCurve& curve)
+        {
+            const Basis& b = basis();
+            const double dx = (x1 - x0) * 0.25;
+            const double c1x = x0 + dx;
+            const double c2x = x1 - dx;
+
+            double px[Samples];
+            double py[Samples];
+            for (int s = 0; s < Samples; ++s)
+            {
+                px[s] = b.x[s][0] * x0 + b.x[s][1] * c1x + b.x[s][2] * c2x + b.x[s][3] * x1;
+                py[s] = b.y[s][0] * y0 + b.y[s][1] * y1;
+            }
+            finish(curve, x0, y0, c1x, c2x, x1, y1, px, py, 1);
+        }
+    } // namespace
+
+    /**
+     * @brief Worker job evaluating one chunk of a batch.
+     */
+    class CurveJob : public QRunnable
+    {
+    public:
+        CurveJob(const EdgeGeometryBatch::Points* points, std::size_t begin, std::size_t end, EdgeCurve* out)
+            : m_points(points)
+            , m_begin(begin)
+            , m_end(end)
+            , m_out(out)
+        {
+            setAutoDelete(true);
+        }
+
+        void run() override
+        {
+            EdgeGeometryBatch::evaluate(*m_points, m_begin, m_end, m_out);
+        }
+
+    private:
+        const EdgeGeometryBatch::Points* m_points;
+        std::size_t m_begin;
+        std::size_t m_end;
+        EdgeCurve* m_out;
+    };
+
+    EdgeGeometryBatch::EdgeGeometryBatch()
+    {
+        // Leave one core to the GUI thread, which takes a chunk itself.
+        m_pool.setMaxThreadCount(std::max(1, QThread::idealThreadCount() - 1));
+    }
+
+    EdgeGeometryBatch&
+    EdgeGeometryBatch::instance()
+    {
+        static EdgeGeometryBatch batch;
+        return batch;
+    }
+
+    void
+    EdgeGeometryBatch::setMaxThreadCount(int count)
+    {
+        m_pool.setMaxThreadCount(std::max(1, count));
+    }
+
+    void
+    EdgeGeometryBatch::setParallelThreshold(std::size_t edges)
+    {
+        m_parallelThreshold = edges;
+    }
+
+    std::size_t
+    EdgeGeometryBatch::parallelThreshold() const
+    {
+        return m_parallelThreshold;
+    }
+
+    void
+    EdgeGeometryBatch::enqueue(ConnectionPathView* edge)
+    {
+        if (!edge || m_queued.count(edge))
+            return;
+        m_queued.emplace(edge, m_queue.size());
+        m_queue.push_back(edge);
+    }
+
+    void
+    EdgeGeometryBatch::cancel(ConnectionPathView* edge)
+    {
+        auto it = m_queued.find(edge);
+        if (it == m_queued.end())
+            return;
+        m_queue[it->second] = nullptr;
+        m_queued.erase(it);
+    }
+
+    std::size_t
+    EdgeGeometryBatch::pendingCount() const
+    {
+        return m_queued.size();
+    }
+
+    void
+    EdgeGeometryBatch::scheduleFlush()
+    {
+        FrameScheduler::instance().post(this, [this]() { flush(); });
+    }
+
+    void
+    EdgeGeometryBatch::flush()
+    {
+        FrameScheduler::instance().cancel(this);
+        if (m_queued.empty())
+            return;
+
+        QElapsedTimer timer;
+        timer.start();
+
+        std::vector<ConnectionPathView*> queue = std::move(m_queue);
+        m_queue.clear();
+        m_queued.clear();
+
+        // Gather on the GUI thread; workers only see plain arrays.
+        Points points;
+        std::vector<ConnectionPathView*> edges;
+        edges.reserve(queue.size());
+        for (auto* v : {&points.x0, &points.y0, &points.x1, &points.y1})
+            v->reserve(queue.size());
+        for (auto* edge : queue)
+        {
+            QPointF start;
+            QPointF end;
+            if (!edge || !edge->curveEnds(&start, &end))
+                continue;
+            edges.push_back(edge);
+            points.x0.push_back(start.x());
+            points.y0.push_back(start.y());
+            points.x1.push_back(end.x());
+            points.y1.push_back(end.y());
+        }
+
+        const std::size_t count = edges.size();
+        std::vector<EdgeCurve> curves(count);
+
+        int chunks = 1;
+        if (count < m_parallelThreshold)
+        {
+            evaluate(points, 0, count, curves.data());
+        }
+        else
+        {
+            for (std::size_t begin = ChunkSize; begin < count; begin += ChunkSize, ++chunks)
+                m_pool.start(new CurveJob(&points, begin, std::min(count, begin + ChunkSize), curves.data()));
+            evaluate(points, 0, std::min(count, ChunkSize), curves.data());
+            m_pool.waitForDone();
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+            edges[i]->applyCurve(curves[i]);
+
+        ++m_stats.flushes;
+        m_stats.curves += count;
+        m_stats.lastFlushNs = timer.nsecsElapsed();
+        m_stats.lastChunks = chunks;
+    }
+
+    EdgeCurve
+    EdgeGeometryBatch::curveFor(const QPointF& start, const QPointF& end)
+    {
+        EdgeCurve curve;
+        evaluateOne(start.x(), start.y(), end.x(), end.y(), curve);
+        return curve;
+    }
+
+    EdgeGeometryBatch::Stats
+    EdgeGeometryBatch::stats() const
+    {
+        return m_stats;
+    }
+
+    void
+    EdgeGeometryBatch::resetStats()
+    {
+        m_stats = Stats();
+    }
+
+    void
+    EdgeGeometryBatch::evaluate(const Points& points, std::size_t begin, std::size_t end, EdgeCurve* out)
+    {
+        std::size_t i = begin;
+
+#ifdef NODEEDITOR_EDGE_SSE2
+        const Basis& b = basis();
+        const __m128d quarter = _mm_set1_pd(0.25);
+
+        // Two curves per step; lane k of every register belongs to curve i + k.
+        for (; i + 2 <= end; i += 2)
+        {
+            const __m128d x0 = _mm_loadu_pd(points.x0.data() + i);
+            const __m128d y0 = _mm_loadu_pd(points.y0.data() + i);
+            const __m128d x1 = _mm_loadu_pd(points.x1.data() + i);
+            const __m128d y1 = _mm_loadu_pd(points.y1.data() + i);
+
+            const __m128d dx = _mm_mul_pd(_mm_sub_pd(x1, x0), quarter);
+            const __m128d c1x = _mm_add_pd(x0, dx);
+            const __m128d c2x = _mm_sub_pd(x1, dx);
+
+            alignas(16) double px[Samples][2];
+            alignas(16) double py[Samples][2];
+            for (int s = 0; s < Samples; ++s)
+            {
+                const auto& wx = b.x[s];
+                const auto& wy = b.y[s];
+                __m128d x = _mm_mul_pd(_mm_set1_pd(wx[0]), x0);
+                x = _mm_add_pd(x, _mm_mul_pd(_mm_set1_pd(wx[1]), c1x));
+                x = _mm_add_pd(x, _mm_mul_pd(_mm_set1_pd(wx[2]), c2x));
+                x = _mm_add_pd(x, _mm_mul_pd(_mm_set1_pd(wx[3]), x1));
+                const __m128d y = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(wy[0]), y0), _mm_mul_pd(_mm_set1_pd(wy[1]), y1));
+                _mm_store_pd(px[s], x);
+                _mm_store_pd(py[s], y);
+            }
+
+            alignas(16) double c1[2];
+            alignas(16) double c2[2];
+            _mm_store_pd(c1, c1x);
+            _mm_store_pd(c2, c2x);
+            for (int k = 0; k < 2; ++k)
+            {
+                const std::size_t e = i + k;
+                finish(out[e], points.x0[e], points.y0[e], c1[k], c2[k], points.x1[e], points.y1[e], &px[0][k], &py[0][k], 2);
+            }
+        }
+#endif
+
+        for (; i < end; ++i)
+            evaluateOne(points.x0[i], points.y0[i], points.x1[i], points.y1[i], out[i]);
+    }
+} // namespace nodeeditor::core::view
@@ -0,0 +1,361 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/EdgeLayerItem.hpp"
+#include "core/view/ConnectionPathView.hpp"
+#include "core/view/FrameScheduler.hpp"
+#include "core/view/PaintDetail.hpp"
+#include "core/view/RenderQuality.hpp"
+
+#include <QPainter>
+#include <QPainterPathStroker>
+#include <QStyleOptionGraphicsItem>
+#include <cmath>
+
+namespace nodeeditor::core::view
+{
+    EdgeLayerItem::EdgeLayerItem(qreal tileSize, QGraphicsItem* parent)
+        : QGraphicsItem(parent)
+        , m_tileSize(tileSize > 0.0 ? tileSize : 512.0)
+        , m_pickIndex(tileSize > 0.0 ? tileSize / 2.0 : 256.0)
+    {
+        setFlag(ItemUsesExtendedStyleOption, true);
+        setAcceptedMouseButtons(Qt::NoButton);
+        setAcceptHoverEvents(false);
+        setZValue(1);
+    }
+
+    EdgeLayerItem::~EdgeLayerItem()
+    {
+        // Not clear(): no geometry change while the item is being destroyed.
+        FrameScheduler::instance().cancel(this);
+        for (auto& [edge, entry] : m_edges)
+            edge->path_changed.disconnect(entry.pathSlot);
+    }
+
+    void
+    EdgeLayerItem::addEdge(ConnectionPathView* edge)
+    {
+        if (!edge || m_edges.count(edge))
+            return;
+
+        auto& entry = m_edges[edge];
+        entry.pathSlot = edge->path_changed.connect([this, edge]() { refreshEdge(edge); });
+
+        entry.bounds = edge->sceneBoundingRect();
+        entry.pen = penKey(edge->pen());
+        attachTiles(edge, entry);
+        m_pickIndex.insert(edge, entry.bounds);
+
+        growBounds(entry.bounds);
+        update(entry.bounds);
+    }
+
+    void
+    EdgeLayerItem::removeEdge(ConnectionPathView* edge)
+    {
+        auto it = m_edges.find(edge);
+        if (it == m_edges.end())
+            return;
+
+        edge->path_changed.disconnect(it->second.pathSlot);
+        detachTiles(edge, it->second);
+        m_pickIndex.remove(edge);
+
+        const QRectF old = it->second.bounds;
+        m_edges.erase(it);
+        update(old);
+        scheduleShrink(old);
+    }
+
+    void
+    EdgeLayerItem::clear()
+    {
+        for (auto& [edge, entry] : m_edges)
+            edge->path_changed.disconnect(entry.pathSlot);
+
+        m_edges.clear();
+        m_tiles.clear();
+        m_pickIndex.clear();
+        update();
+
+        FrameScheduler::instance().cancel(this);
+        prepareGeometryChange();
+        m_bounds = QRectF();
+    }
+
+    bool
+    EdgeLayerItem::containsEdge(ConnectionPathView* edge) const
+    {
+        return m_edges.count(edge) != 0;
+    }
+
+    std::size_t
+    EdgeLayerItem::edgeCount() const
+    {
+        return m_edges.size();
+    }
+
+    ConnectionPathView*
+    EdgeLayerItem::edgeAt(const QPointF& scenePos, qreal radius) const
+    {
+        const QRectF probe(scenePos.x() - radius, scenePos.y() - radius, 2 * radius, 2 * radius);
+
+        ConnectionPathView* hit = nullptr;
+        m_pickIndex.query(probe, [&](ConnectionPathView* const& edge, const QRectF&) {
+            if (hit)
+                return;
+            QPainterPathStroker stroker;
+            stroker.setWidth(2 * radius);
+            if (stroker.createStroke(edge->currentPath()).contains(edge->mapFromScene(scenePos)))
+                hit = edge;
+        });
+        return hit;
+    }
+
+    void
+    EdgeLayerItem::refreshEdge(ConnectionPathView* edge)
+    {
+        auto it = m_edges.find(edge);
+        if (it == m_edges.end())
+            return;
+
+        auto& entry = it->second;
+        const QRectF old = entry.bounds;
+
+        detachTiles(edge, entry);
+        entry.bounds = edge->sceneBoundingRect();
+        entry.pen = penKey(edge->pen());
+        attachTiles(edge, entry);
+        m_pickIndex.insert(edge, entry.bounds);
+
+        growBounds(entry.bounds);
+        update(old);
+        update(entry.bounds);
+        scheduleShrink(old);
+    }
+
+    QRectF
+    EdgeLayerItem::boundingRect() const
+    {
+        return m_bounds;
+    }
+
+    QPainterPath
+    EdgeLayerItem::shape() const
+    {
+        return QPainterPath();
+    }
+
+    void
+    EdgeLayerItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget*)
+    {
+        const QRectF exposed = option ? option->exposedRect : m_bounds;
+        if (m_tiles.empty() || exposed.isEmpty() || PaintDetail::current() != PaintDetail::Full)
+            return;
+
+        const RenderQuality& quality = RenderQuality::instance();
+        painter->save();
+        painter->setRenderHint(QPainter::Antialiasing, quality.edgeAntialiasing());
+        painter->setBrush(Qt::NoBrush);
+
+        const int tx0 = int(std::floor(exposed.left() / m_tileSize));
+        const int ty0 = int(std::floor(exposed.top() / m_tileSize));
+        const int tx1 = int(std::floor(exposed.right() / m_tileSize));
+        const int ty1 = int(std::floor(exposed.bottom() / m_tileSize));
+
+        for (int ty = ty0; ty <= ty1; ++ty)
+            for (int tx = tx0; tx <= tx1; ++tx)
+            {
+                auto it = m_tiles.find(tileKey(tx, ty));
+                if (it == m_tiles.end())
+                    continue;
+
+                Tile& tile = it->second;
+                if (tile.dirty)
+                    rebuildTile(tile);
+
+                // Each tile holds whole curves; clip so shared edges are not overdrawn.
+                painter->setClipRect(tileRect(it->first));
+                if (!quality.curvedEdges())
+                {
+                    // Lines are cheap enough to draw per edge; the cached curves stay valid.
+                    for (ConnectionPathView* edge : tile.edges)
+                    {
+                        painter->setPen(penFor(m_edges.at(edge).pen));
+                        painter->drawLine(QLineF(edge->curve().start, edge->curve().end));
+                    }
+                    continue;
+                }
+                for (const auto& [key, path] : tile.paths)
+                {
+                    painter->setPen(penFor(key));
+                    painter->drawPath(path);
+                }
+            }
+
+        painter->restore();
+    }
+
+    // ---------------- Tiles -------------------
+
+    EdgeLayerItem::PenKey
+    EdgeLayerItem::penKey(const QPen& pen)
+    {
+        PenKey key;
+        key.color = pen.color().rgba();
+        key.width = int(std::lround(pen.widthF() * 100.0));
+        key.style = pen.style();
+        if (key.style == Qt::CustomDashLine)
+            key.dashes = pen.dashPattern();
+        if (key.style != Qt::SolidLine)
+            key.dashOffset = pen.dashOffset();
+        return key;
+    }
+
+    QPen
+    EdgeLayerItem::penFor(const PenKey& key)
+    {
+        QPen pen(QColor::fromRgba(key.color), key.width / 100.0);
+        pen.setStyle(key.style);
+        if (key.style == Qt::CustomDashLine)
+            pen.setDashPattern(key.dashes);
+        if (key.style != Qt::SolidLine)
+            pen.setDashOffset(key.dashOffset);
+        pen.setCapStyle(Qt::RoundCap);
+        pen.setJoinStyle(Qt::RoundJoin);
+        return pen;
+    }
+
+    EdgeLayerItem::TileKey
+    EdgeLayerItem::tileKey(int tx, int ty) const
+    {
+        return (quint64(quint32(tx)) << 32) | quint64(quint32(ty));
+    }
+
+    QRectF
+    EdgeLayerItem::tileRect(TileKey key) const
+    {
+        const int tx = int(qint32(quint32(key >> 32)));
+        const int ty = int(qint32(quint32(key & 0xffffffffu)));
+        return QRectF(tx * m_tileSize, ty * m_tileSize, m_tileSize, m_tileSize);
+    }
+
+    std::vector<EdgeLayerItem::TileKey>
+    EdgeLayerItem::tilesFor(const QRectF& bounds) const
+    {
+        std::vector<TileKey> keys;
+        if (bounds.isNull())
+            return keys;
+
+        const int tx0 = int(std::floor(bounds.left() / m_tileSize));
+        const int ty0 = int(std::floor(bounds.top() / m_tileSize));
+        const int tx1 = int(std::floor(bounds.right() / m_tileSize));
+        const int ty1 = int(std::floor(bounds.bottom() / m_tileSize));
+        keys.reserve(std::size_t(tx1 - tx0 + 1) * std::size_t(ty1 - ty0 + 1));
+
+        for (int ty = ty0; ty <= ty1; ++ty)
+            for (int tx = tx0; tx <= tx1; ++tx)
+                keys.push_back(tileKey(tx, ty));
+        return keys;
+    }
+
+    void
+    EdgeLayerItem::attachTiles(ConnectionPathView* edge, EdgeEntry& entry)
+    {
+        entry.tiles = tilesFor(entry.bounds);
+        for (TileKey key : entry.tiles)
+        {
+            Tile& tile = m_tiles[key];
+            tile.edges.insert(edge);
+            tile.dirty = true;
+        }
+    }
+
+    void
+    EdgeLayerItem::detachTiles(ConnectionPathView* edge, EdgeEntry& entry)
+    {
+        for (TileKey key : entry.tiles)
+        {
+            auto it = m_tiles.find(key);
+            if (it == m_tiles.end())
+                continue;
+            it->second.edges.erase(edge);
+            if (it->second.edges.empty())
+                m_tiles.erase(it);
+            else
+                it->second.dirty = true;
+        }
+        entry.tiles.clear();
+    }
+
+    void
+    EdgeLayerItem::rebuildTile(Tile& tile) const
+    {
+        tile.paths.clear();
+        for (ConnectionPathView* edge : tile.edges)
+        {
+            auto it = m_edges.find(edge);
+            if (it == m_edges.end())
+                continue;
+            tile.paths[it->second.pen].addPath(edge->sceneTransform().map(edge->currentPath()));
+        }
+        tile.dirty = false;
+    }
+
+    void
+    EdgeLayerItem::growBounds(const QRectF& r)
+    {
+        if (r.isNull() || m_bounds.contains(r))
+            return;
+        prepareGeometryChange();
+        m_bounds = m_bounds.isNull() ? r : m_bounds.united(r);
+    }
+
+    void
+    EdgeLayerItem::scheduleShrink(const QRectF& r)
+    {
+        // Edges strictly inside the bounds cannot shrink them.
+        if (r.isNull() || (r.left() > m_bounds.left() && r.top() > m_bounds.top() &&
+                           r.right() < m_bounds.right() && r.bottom() < m_bounds.bottom()))
+            return;
+        FrameScheduler::instance().post(this, [this]() { recomputeBounds(); });
+    }
+
+    void
+    EdgeLayerItem::recomputeBounds()
+    {
+        QRectF bounds;
+        for (const auto& [edge, entry] : m_edges)
+        {
+            if (!entry.bounds.isNull())
+                bounds = bounds.isNull() ? entry.bounds : bounds.united(entry.bounds);
+        }
+        if (bounds == m_bounds)
+            return;
+        prepareGeometryChange();
+        m_bounds = bounds;
+    }
+
+} // namespace nodeeditor::core::view
@@ -1,4 +1,6 @@
 #include "core/view/EditableArrowItemView.hpp"
+#include "core/view/PaintDetail.hpp"
+#include "core/view/RenderQuality.hpp"
 
 #include <QFont>
 #include <QGraphicsProxyWidget>
@@ -9,6 +11,38 @@
 
 namespace nodeeditor::core::view
 {
+    const QFont& EditableArrowItemView::labelFont()
+    {
+        static const QFont font("Arial", 10, QFont::Bold);
+        return font;
+    }
+
+    QPolygonF EditableArrowItemView::arrowPolygon(bool arrowBeforeLabel, qreal textWidth, qreal textHeight)
+    {
+        const qreal arrowW = ArrowWidth;
+        const qreal arrowH = ArrowWidth;
+        QPointF arrowPos = arrowBeforeLabel ? QPointF(0, (textHeight - arrowH) / 2.0)
+                                            : QPointF(textWidth + ArrowSpacing, (textHeight - arrowH) / 2.0);
+
+        QPolygonF arrow;
+        arrow << QPointF(0, 0)
+              << QPointF(arrowW, arrowH / 2.0)
+              << QPointF(0, arrowH)
+              << QPointF(0, 0);
+
+        if (arrowBeforeLabel)
+        {
+            QTransform t;
+            const QRectF br = arrow.boundingRect();
+            t.translate(br.center().x(), br.center().y());
+            t.rotate(180);
+            t.translate(-br.center().x(), -br.center().y());
+            arrow = t.map(arrow);
+        }
+
+        arrow.translate(arrowPos);
+        return arrow;
+    }
 
     EditableArrowItemView::EditableArrowItemView(const QString& text, QGraphicsItem* parent)
         : common::view::AbstractItemView(parent)
@@ -17,18 +51,7 @@ namespace nodeeditor::core::view
         setFlag(QGraphicsItem::ItemIsSelectable, false);
         setFlag(QGraphicsItem::ItemIsMovable, false);
 
-        labelItem_ = new QGraphicsTextItem(text, this);
-        labelItem_->setDefaultTextColor(Qt::white);
-        labelItem_->setFont(QFont("Arial", 10, QFont::Bold));
-
-        editWidget_ = new QLineEdit(text);
-        editProxy_ = new QGraphicsProxyWidget(this);
-        editProxy_->setWidget(editWidget_);
-        editProxy_->setVisible(false);
-
-        QObject::connect(editWidget_, &QLineEdit::editingFinished, [this]() {
-            finishEditing();
-        });
+        layout_ = TextLayoutCache::instance().layout(text, labelFont());
 
         text_ = text.toStdString();
         repositionElements();
@@ -55,54 +78,38 @@ namespace nodeeditor::core::view
 
     qreal EditableArrowItemView::textWidth() const
     {
-        return labelItem_ ? labelItem_->boundingRect().width() : 0.0;
+        return layout_.size.width();
     }
 
     qreal EditableArrowItemView::textHeight() const
     {
-        return labelItem_ ? labelItem_->boundingRect().height() : 0.0;
+        return layout_.size.height();
     }
 
     // ---------------- QGraphicsItem -------------------
     QRectF EditableArrowItemView::boundingRect() const
     {
-        const qreal arrowW = 10.0;
-        const qreal spacing = 4.0;
-        return QRectF(0, 0, arrowW + spacing + textWidth(), std::max<qreal>(arrowW, textHeight()));
+        return QRectF(0, 0, ArrowWidth + ArrowSpacing + textWidth(), std::max<qreal>(ArrowWidth, textHeight()));
     }
 
     void EditableArrowItemView::paint(QPainter* painter, const QStyleOptionGraphicsItem*, QWidget*)
     {
-        if (!painter)
+        if (!painter || PaintDetail::current() != PaintDetail::Full)
             return;
+
+        if (!editProxy_ && (!labelDroppable_ || RenderQuality::instance().portLabels()))
+        {
+            painter->setFont(labelFont());
+            painter->setPen(Qt::white);
+            TextLayoutCache::draw(*painter, labelPos(), layout_);
+        }
+
         if (!showArrow_)
             return;
 
         painter->setRenderHint(QPainter::Antialiasing, true);
 
-        const qreal arrowW = 10.0;
-        const qreal arrowH = 10.0;
-        const qreal spacing = 4.0;
-        QPointF arrowPos = arrowBeforeLabel_ ? QPointF(0, (textHeight() - arrowH) / 2.0)
-                                             : QPointF(textWidth() + spacing, (textHeight() - arrowH) / 2.0);
-
-        QPolygonF arrow;
-        arrow << QPointF(0, 0)
-              << QPointF(arrowW, arrowH / 2.0)
-              << QPointF(0, arrowH)
-              << QPointF(0, 0);
-
-        if (arrowBeforeLabel_)
-        {
-            QTransform t;
-            const QRectF br = arrow.boundingRect();
-            t.translate(br.center().x(), br.center().y());
-            t.rotate(180);
-            t.translate(-br.center().x(), -br.center().y());
-            arrow = t.map(arrow);
-        }
-
-        arrow.translate(arrowPos);
+        const QPolygonF arrow = arrowPolygon(arrowBeforeLabel_, textWidth(), textHeight());
 
         painter->setBrush(color_);
         painter->setPen(Qt::NoPen);
@@ -111,50 +118,66 @@ namespace nodeeditor::core::view
 
     void EditableArrowItemView::startEditing()
     {
-        if (!labelItem_ || !editProxy_ || !editWidget_)
+        if (!editable_ || editProxy_)
             return;
 
-        labelItem_->setVisible(false);
-        editProxy_->setVisible(true);
-        editWidget_->setText(QString::fromStdString(text_));
+        editWidget_ = new QLineEdit(QString::fromStdString(text_));
+        editProxy_ = new QGraphicsProxyWidget(this);
+        editProxy_->setWidget(editWidget_);
+        editProxy_->setGeometry(QRectF(QPointF(), layout_.size));
+        editProxy_->setPos(labelPos());
+
+        QObject::connect(editWidget_, &QLineEdit::editingFinished, [this]() {
+            finishEditing();
+        });
+
+        update();
         editWidget_->selectAll();
         editWidget_->setFocus();
     }
 
     void EditableArrowItemView::finishEditing()
     {
-        if (!editProxy_ || !editProxy_->isVisible())
+        if (!editProxy_)
             return;
 
-        editProxy_->setVisible(false);
-        if (labelItem_)
-            labelItem_->setVisible(true);
+        // Detach first: editingFinished fires again when the widget loses focus.
+        QGraphicsProxyWidget* proxy = editProxy_;
+        const QString text = editWidget_->text();
+        editProxy_ = nullptr;
+        editWidget_ = nullptr;
+
+        proxy->setVisible(false);
+        proxy->deleteLater();
 
-        set_text(editWidget_->text().toStdString());
-        labelItem_->setPlainText(editWidget_->text());
+        set_text(text.toStdString());
 
         if (onTextChanged)
-            onTextChanged(editWidget_->text());
+            onTextChanged(text);
         repositionElements();
     }
 
-    void EditableArrowItemView::repositionElements()
+    bool EditableArrowItemView::isEditing() const
     {
-        if (!labelItem_ || !editProxy_)
-            return;
-
-        prepareGeometryChange();
-
-        labelItem_->adjustSize();
-        editProxy_->setGeometry(labelItem_->boundingRect());
+        return editProxy_ != nullptr;
+    }
 
-        qreal xOffset = 0.;
+    QPointF EditableArrowItemView::labelPos() const
+    {
+        if (showArrow_ && arrowBeforeLabel_)
+            return QPointF(ArrowWidth + ArrowSpacing, 0);
+        return QPointF(0, 0);
+    }
 
-        if (showArrow_)
-            xOffset = arrowBeforeLabel_ ? 10.0 + 4.0 : 0.0;
+    void EditableArrowItemView::repositionElements()
+    {
+        prepareGeometryChange();
 
-        labelItem_->setPos(xOffset, 0);
-        editProxy_->setPos(xOffset, 0);
+        if (editProxy_)
+        {
+            editProxy_->setGeometry(QRectF(QPointF(), layout_.size));
+            editProxy_->setPos(labelPos());
+        }
 
         update();
     }
@@ -165,8 +188,12 @@ namespace nodeeditor::core::view
             return;
         showArrow_ = newShowArrow;
 
-        prepareGeometryChange();
-        update();
+        repositionElements();
+    }
+
+    void EditableArrowItemView::setLabelDroppable(bool droppable)
+    {
+        labelDroppable_ = droppable;
     }
 
     void EditableArrowItemView::set_text(const std::string& t)
@@ -176,8 +203,7 @@ namespace nodeeditor::core::view
 
         text_ = t;
 
-        if (labelItem_)
-            labelItem_->setPlainText(QString::fromStdString(t));
+        layout_ = TextLayoutCache::instance().layout(QString::fromStdString(t), labelFont());
         if (editWidget_)
             editWidget_->setText(QString::fromStdString(t));
 
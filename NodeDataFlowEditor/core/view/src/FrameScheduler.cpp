@@ -0,0 +1,95 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/FrameScheduler.hpp"
+
+namespace nodeeditor::core::view
+{
+    FrameScheduler::FrameScheduler()
+    {
+        m_timer.setSingleShot(true);
+        m_timer.setInterval(0);
+        QObject::connect(&m_timer, &QTimer::timeout, this, [this]() { flush(); });
+    }
+
+    FrameScheduler&
+    FrameScheduler::instance()
+    {
+        static FrameScheduler scheduler;
+        return scheduler;
+    }
+
+    void
+    FrameScheduler::post(const void* key, Task task)
+    {
+        auto it = m_index.find(key);
+        if (it != m_index.end())
+        {
+            m_tasks[it->second].second = std::move(task);
+            return;
+        }
+
+        m_index.emplace(key, m_tasks.size());
+        m_tasks.emplace_back(key, std::move(task));
+
+        if (!m_timer.isActive())
+            m_timer.start();
+    }
+
+    void
+    FrameScheduler::cancel(const void* key)
+    {
+        auto it = m_index.find(key);
+        if (it == m_index.end())
+            return;
+
+        m_tasks[it->second].second = nullptr;
+        m_index.erase(it);
+    }
+
+    bool
+    FrameScheduler::isPending(const void* key) const
+    {
+        return m_index.count(key) != 0;
+    }
+
+    void
+    FrameScheduler::flush()
+    {
+        m_timer.stop();
+
+        // A task may post follow-up work (e.g. a layout moving ports); drain until quiet.
+        while (!m_tasks.empty())
+        {
+            auto tasks = std::move(m_tasks);
+            m_tasks.clear();
+            m_index.clear();
+
+            for (auto& [key, task] : tasks)
+                if (task)
+                    task();
+        }
+    }
+
+} // namespace nodeeditor::core::view
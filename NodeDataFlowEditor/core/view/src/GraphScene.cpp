@@ -7,15 +7,97 @@
 #include "core/presenter/NodeItemPresenter.hpp"
 #include "core/presenter/PortItemPresenter.hpp"
 #include "core/view/ConnectionPathView.hpp"
+#include "core/view/EdgeGeometryBatch.hpp"
+#include "core/view/EdgeLayerItem.hpp"
+#include "core/view/FrameScheduler.hpp"
 #include "core/view/NodeItemView.hpp"
+#include "core/view/NodeRasterizer.hpp"
+#include "core/view/ParameterControl.hpp"
+#include "core/view/ParameterTypeRegistry.hpp"
 #include "core/view/PortItemView.hpp"
+#include "core/view/ViewPool.hpp"
+#include <QApplication>
+#include <QGraphicsPixmapItem>
+#include <QGraphicsView>
+#include <QLineF>
+#include <QPainter>
+#include <QSignalBlocker>
+#include <QStyleOptionGraphicsItem>
+#include <QTimer>
+#include <algorithm>
+#include <cmath>
 #include <qgraphicssceneevent.h>
+#include <utility>
 
 using namespace nodeeditor::core;
 
+namespace
+{
+    /** @brief Slack around port rects for presses, shared by picking and connection drags. */
+    constexpr qreal PortPickRadius = 4.0;
+
+    /** @brief Paint @p item and its children the way the scene would, into any painter. */
+    void
+    paintItemTree(QPainter* painter, QGraphicsItem* item, const QTransform& toTarget)
+    {
+        if (!item->isVisible() || qFuzzyIsNull(item->opacity()))
+            return;
+
+        auto children = item->childItems();
+        std::stable_sort(children.begin(), children.end(), [](QGraphicsItem* a, QGraphicsItem* b) {
+            const bool aBehind = a->flags() & QGraphicsItem::ItemStacksBehindParent;
+            const bool bBehind = b->flags() & QGraphicsItem::ItemStacksBehindParent;
+            if (aBehind != bBehind)
+                return aBehind;
+            return a->zValue() < b->zValue();
+        });
+
+        auto child = children.begin();
+        for (; child != children.end() && ((*child)->flags() & QGraphicsItem::ItemStacksBehindParent); ++child)
+            paintItemTree(painter, *child, toTarget);
+
+        QStyleOptionGraphicsItem option;
+        option.exposedRect = item->boundingRect();
+        option.rect = option.exposedRect.toAlignedRect();
+        if (item->isSelected())
+            option.state |= QStyle::State_Selected;
+
+        painter->save();
+        painter->setTransform(item->sceneTransform() * toTarget);
+        painter->setOpacity(item->effectiveOpacity());
+        item->paint(painter, &option, nullptr);
+        painter->restore();
+
+        for (; child != children.end(); ++child)
+            paintItemTree(painter, *child, toTarget);
+    }
+} // namespace
+
 NodeEditorScene::NodeEditorScene(QObject* parent)
     : QGraphicsScene(parent)
-{}
+{
+    m_inputClock.start();
+}
+
+NodeEditorScene::~NodeEditorScene()
+{
+    view::FrameScheduler::instance().cancel(&m_groupMove);
+    view::FrameScheduler::instance().cancel(&m_pendingMove);
+
+    // Hand the views back to their pools first, then empty the pools while
+    // Qt is still up; the pools themselves outlive QApplication.
+    if (m_edgeLayer)
+        m_edgeLayer->clear();
+    for (auto& [name, ends] : m_nodeEdges)
+        for (auto& end : ends)
+            unbindPortEdge(end);
+    m_connections.clear();
+    m_nodes.clear();
+    m_parkedNodes.clear();
+    view::ViewPool<view::ConnectionPathView>::instance().clear();
+    view::ViewPool<view::NodeItemView>::instance().clear();
+    view::ViewPool<view::PortItemView>::instance().clear();
+}
 
 std::shared_ptr<nodeeditor::core::presenter::NodeItemPresenter>
 NodeEditorScene::createNode(
@@ -25,27 +107,72 @@ NodeEditorScene::createNode(
     auto model = std::make_shared<model::NodeItemModel>();
     model->set_pos(common::utility::SPos(pos.x(), pos.y()));
     model->set_text(name.toStdString());
-    auto view = std::make_shared<view::NodeItemView>(name, name);
+    auto view = view::ViewPool<view::NodeItemView>::instance().acquire(name, name);
     view->setPos(pos);
 
     auto presenter = std::make_shared<nodeeditor::core::presenter::NodeItemPresenter>(model, view);
 
+    if (m_parkedNodes.erase(name))
+        m_parkedIndex.remove(name);
+    if (auto old = m_nodes.find(name); old != m_nodes.end())
+        if (auto* oldView = dynamic_cast<view::NodeItemView*>(old->second->view().get()))
+            detachNodeView(oldView);
+
+    attachNodeView(name, view.get(), model);
     this->addItem(view.get());
     m_nodes[name] = presenter;
 
+    // Created live so callers can populate it; parked on the next pass if off screen.
+    scheduleVirtualization();
+
     return presenter;
 }
 
+void
+NodeEditorScene::attachNodeView(const QString& name, view::NodeItemView* nodeView, const std::shared_ptr<model::NodeItemModel>& nodeModel)
+{
+    nodeView->moved_by.connect([this, name, nodeView](const QPointF& delta) {
+        m_spatialIndex.moveNode(nodeView, delta);
+        // A group move shifts the edges of its nodes itself.
+        if (!m_groupMove.active || !m_groupMove.nodes.count(nodeView))
+            translateNodeEdges(name, delta);
+    });
+    nodeView->rows_changed.connect([this, name, nodeView]() {
+        m_spatialIndex.refreshNode(nodeView);
+        refreshRowEdges(name);
+    });
+    // Every arrange may move item ports or resize the body, rows or not.
+    nodeView->layout_changed.connect([this, nodeView]() { m_spatialIndex.refreshNode(nodeView); });
+    nodeView->select_changed.connect([this, nodeView](const bool& selected) { syncItemSelection(nodeView, selected); });
+    m_spatialIndex.addNode(nodeView);
+    addSelectable(nodeView, {nodeView, nullptr, nodeModel, {}});
+    nodeView->setCacheMode(m_nodeCacheMode);
+}
+
+void
+NodeEditorScene::detachNodeView(view::NodeItemView* nodeView)
+{
+    if (m_groupMove.nodes.count(nodeView))
+        endGroupMove();
+    if (m_pressedNode == nodeView)
+        m_pressedNode = nullptr;
+    m_spatialIndex.removeNode(nodeView);
+    removeSelectable(nodeView);
+
+    // Its ports go back to the pool with it; edges left behind stop following them.
+    auto edgesIt = m_nodeEdges.find(nodeView->nodeName());
+    if (edgesIt != m_nodeEdges.end())
+        for (auto& end : edgesIt->second)
+            unbindPortEdge(end);
+}
+
 bool
 NodeEditorScene::removeNode(const QString& nodeId)
 {
-    auto it = m_nodes.find(nodeId);
-    if (it == m_nodes.end())
+    const bool parked = m_parkedNodes.count(nodeId) != 0;
+    if (!parked && m_nodes.find(nodeId) == m_nodes.end())
         return false;
 
-    auto presenter = it->second;
-    auto view = dynamic_cast<nodeeditor::core::view::ConnectionPathView*>(presenter->view().get());
-
     std::vector<std::shared_ptr<nodeeditor::core::presenter::ConnectionPathPresenter>> connsToRemove;
     for (const auto& cp : m_connections)
     {
@@ -60,8 +187,21 @@ NodeEditorScene::removeNode(const QString& nodeId)
     for (auto& cid : connsToRemove)
         removeConnection(cid);
 
-    if (view)
-        this->removeItem(view);
+    m_nodeEdges.erase(nodeId);
+    if (parked)
+    {
+        m_parkedIndex.remove(nodeId);
+        m_parkedNodes.erase(nodeId);
+        return true;
+    }
+
+    auto it = m_nodes.find(nodeId);
+    auto presenter = it->second;
+    if (auto* nodeView = dynamic_cast<view::NodeItemView*>(presenter->view().get()))
+    {
+        detachNodeView(nodeView);
+        this->removeItem(nodeView);
+    }
 
     m_nodes.erase(it);
 
@@ -78,50 +218,234 @@ NodeEditorScene::createConnection(
 
     auto viewFrom = dynamic_cast<nodeeditor::core::view::PortItemView*>(from->view().get());
     auto viewTo = dynamic_cast<nodeeditor::core::view::PortItemView*>(to->view().get());
+    if (!viewFrom || !viewTo)
+        return nullptr;
+
+    // Port positions are laid out once per frame; make sure they are current.
+    view::FrameScheduler::instance().flush();
 
-    ConnectionPortData p1{viewFrom->pos(), viewFrom->boundingRect(), viewFrom->name(), viewFrom->displayName(), true};
-    ConnectionPortData p2{viewTo->pos(), viewTo->boundingRect(), viewTo->name(), viewTo->displayName(), false};
+    ConnectionPortData p1{viewFrom->scenePos(), viewFrom->boundingRect(), viewFrom->name(), viewFrom->displayName(), true};
+    ConnectionPortData p2{viewTo->scenePos(), viewTo->boundingRect(), viewTo->name(), viewTo->displayName(), false};
     auto model = std::make_shared<model::ConnectionPathModel>();
 
-    auto view = std::make_shared<view::ConnectionPathView>(p1, p2);
+    auto view = view::ViewPool<view::ConnectionPathView>::instance().acquire(p1, p2);
 
     auto presenter = std::make_shared<presenter::ConnectionPathPresenter>(model, view);
     auto rawView = view.get();
-    this->addItem(rawView);
-    m_connections.emplace_back(presenter);
-    viewFrom->pos_changed.connect([this, rawView](const common::utility::SPos& pos) {
-        if (rawView)
-            rawView->set_inputPos(pos);
-    });
-    viewTo->pos_changed.connect([this, rawView](const common::utility::SPos& pos) {
-        if (rawView)
-            rawView->set_outputPos(pos);
-    });
+    registerConnection(presenter, rawView);
+    // Node moves arrive once per node through moved_by; port pos_changed only
+    // fires when the node re-lays out, and carries node-local coordinates.
+    auto& fromEnds = m_nodeEdges[viewFrom->moduleName()];
+    fromEnds.push_back({rawView, true, QString(), viewFrom->name()});
+    bindPortEdge(fromEnds.back(), viewFrom);
+    auto& toEnds = m_nodeEdges[viewTo->moduleName()];
+    toEnds.push_back({rawView, false, QString(), viewTo->name()});
+    bindPortEdge(toEnds.back(), viewTo);
+    m_edgeNodes[rawView] = {viewFrom->moduleName(), viewTo->moduleName()};
     return presenter;
 }
 
+void
+NodeEditorScene::bindPortEdge(NodeEdgeEnd& end, view::PortItemView* port)
+{
+    unbindPortEdge(end);
+    // Edges and ports are pooled: the slot must go with the edge (detachNodeEdge)
+    // or with the port's node (detachNodeView), whichever leaves first.
+    end.port = port;
+    end.portSlot = port->pos_changed.connect([edge = end.edge, port, inputEnd = end.inputEnd](const common::utility::SPos&) {
+        const common::utility::SPos pos(port->scenePos().x(), port->scenePos().y());
+        if (inputEnd)
+            edge->set_inputPos(pos);
+        else
+            edge->set_outputPos(pos);
+    });
+}
+
+void
+NodeEditorScene::unbindPortEdge(NodeEdgeEnd& end)
+{
+    if (!end.port)
+        return;
+    end.port->pos_changed.disconnect(end.portSlot);
+    end.port = nullptr;
+    end.portSlot = 0;
+}
+
 bool
 NodeEditorScene::createConnection(const QString& fromNode,
                                   const QString& fromPort,
                                   const QString& toNode,
                                   const QString& toPort)
 {
-    auto fromIt = m_nodes.find(fromNode);
-    if (fromIt == m_nodes.end())
+    auto fromNodePresenter = liveNode(fromNode);
+    if (!fromNodePresenter)
+        return false;
+
+    auto fromPresenter = fromNodePresenter->getInputPort(fromPort.toStdString());
+
+    auto toNodePresenter = liveNode(toNode);
+    if (!toNodePresenter)
+        return false;
+    auto toPresenter = toNodePresenter->getOutputPort(toPort.toStdString());
+
+    if (fromPresenter && toPresenter)
+    {
+        createConnection(fromPresenter, toPresenter);
+        return true;
+    }
+
+    // Fall back to painted port rows.
+    return createRowConnection(fromNode, fromPort, toNode, toPort);
+}
+
+bool
+NodeEditorScene::createRowConnection(const QString& fromNode,
+                                     const QString& fromPort,
+                                     const QString& toNode,
+                                     const QString& toPort)
+{
+    auto fromPresenter = liveNode(fromNode);
+    auto toPresenter = liveNode(toNode);
+    if (!fromPresenter || !toPresenter)
+        return false;
+
+    auto fromView = dynamic_cast<view::NodeItemView*>(fromPresenter->view().get());
+    auto toView = dynamic_cast<view::NodeItemView*>(toPresenter->view().get());
+    if (!fromView || !toView)
         return false;
 
-    auto fromPresenter = fromIt->second->getInputPort(fromPort.toStdString());
+    view::FrameScheduler::instance().flush();
 
-    auto toIt = m_nodes.find(toNode);
-    if (toIt == m_nodes.end())
+    QRectF fromRect;
+    QRectF toRect;
+    if (!fromView->rowSceneRect(view::PortTable::Side::Input, fromPort, &fromRect) ||
+        !toView->rowSceneRect(view::PortTable::Side::Output, toPort, &toRect))
         return false;
-    auto toPresenter = toIt->second->getOutputPort(toPort.toStdString());
 
-    createConnection(fromPresenter, toPresenter);
+    ConnectionPortData p1{fromRect.topLeft(), QRectF(QPointF(), fromRect.size()), fromPort, fromNode, true};
+    ConnectionPortData p2{toRect.topLeft(), QRectF(QPointF(), toRect.size()), toPort, toNode, false};
+
+    auto model = std::make_shared<model::ConnectionPathModel>();
+    auto view = view::ViewPool<view::ConnectionPathView>::instance().acquire(p1, p2);
+    auto presenter = std::make_shared<presenter::ConnectionPathPresenter>(model, view);
+    model->set_input(common::utility::SPort{fromPort.toStdString(), fromNode.toStdString(), true});
+    model->set_output(common::utility::SPort{toPort.toStdString(), toNode.toStdString(), false});
+
+    auto rawView = view.get();
+    registerConnection(presenter, rawView);
 
+    m_nodeEdges[fromNode].push_back({rawView, true, fromPort});
+    m_nodeEdges[toNode].push_back({rawView, false, toPort});
+    m_edgeNodes[rawView] = {fromNode, toNode};
+    fromView->linkRow(view::PortTable::Side::Input, fromPort, 1);
+    toView->linkRow(view::PortTable::Side::Output, toPort, 1);
     return true;
 }
 
+void
+NodeEditorScene::registerConnection(const std::shared_ptr<presenter::ConnectionPathPresenter>& presenter,
+                                    view::ConnectionPathView* rawView)
+{
+    if (m_edgeLayer)
+        m_edgeLayer->addEdge(rawView);
+    else
+        this->addItem(rawView);
+    m_connections.emplace_back(presenter);
+    m_spatialIndex.addEdge(rawView);
+    addSelectable(rawView, {nullptr, rawView, {}, std::dynamic_pointer_cast<model::ConnectionPathModel>(presenter->model())});
+
+    rawView->select_changed.connect([this, rawView](const bool& selected) {
+        syncItemSelection(rawView, selected);
+        if (!selected)
+            scheduleEdgeBatch(rawView);
+    });
+    rawView->active_changed.connect([this, rawView](const bool& active) {
+        if (active)
+            promoteEdge(rawView);
+        else
+            scheduleEdgeBatch(rawView);
+    });
+}
+
+void
+NodeEditorScene::refreshRowEdges(const QString& nodeName)
+{
+    auto nodeIt = m_nodes.find(nodeName);
+    auto edgesIt = m_nodeEdges.find(nodeName);
+    if (nodeIt == m_nodes.end() || edgesIt == m_nodeEdges.end())
+        return;
+
+    auto nodeView = dynamic_cast<view::NodeItemView*>(nodeIt->second->view().get());
+    if (!nodeView)
+        return;
+
+    for (const auto& end : edgesIt->second)
+    {
+        if (end.rowName.isEmpty())
+            continue;
+
+        QRectF rect;
+        const auto side = end.inputEnd ? view::PortTable::Side::Input : view::PortTable::Side::Output;
+        if (!nodeView->rowSceneRect(side, end.rowName, &rect))
+            continue;
+
+        const common::utility::SPos pos(rect.x(), rect.y());
+        if (end.inputEnd)
+            end.edge->set_inputPos(pos);
+        else
+            end.edge->set_outputPos(pos);
+    }
+}
+
+bool
+NodeEditorScene::addInputRow(const QString& nodeId, const QString& portName, const QString& displayName)
+{
+    auto nodePresenter = liveNode(nodeId);
+    if (!nodePresenter)
+        return false;
+    auto nodeView = dynamic_cast<view::NodeItemView*>(nodePresenter->view().get());
+    return nodeView && nodeView->addInputRow(portName, displayName);
+}
+
+bool
+NodeEditorScene::addOutputRow(const QString& nodeId, const QString& portName, const QString& displayName)
+{
+    auto nodePresenter = liveNode(nodeId);
+    if (!nodePresenter)
+        return false;
+    auto nodeView = dynamic_cast<view::NodeItemView*>(nodePresenter->view().get());
+    return nodeView && nodeView->addOutputRow(portName, displayName);
+}
+
+bool
+NodeEditorScene::setPortTags(const QString& nodeId, const QString& portName, const common::taggable::TagBitMask& tags)
+{
+    auto nodePresenter = liveNode(nodeId);
+    if (!nodePresenter)
+        return false;
+    auto nodeView = dynamic_cast<view::NodeItemView*>(nodePresenter->view().get());
+    if (!nodeView)
+        return false;
+
+    bool found = false;
+    if (auto port = nodeView->findInput(portName))
+    {
+        port->setTagBitMask(tags);
+        found = true;
+    }
+    if (auto port = nodeView->findOutput(portName))
+    {
+        port->setTagBitMask(tags);
+        found = true;
+    }
+    found = nodeView->setRowTags(view::PortTable::Side::Input, portName, tags) || found;
+    found = nodeView->setRowTags(view::PortTable::Side::Output, portName, tags) || found;
+
+    if (found)
+        m_spatialIndex.refreshNode(nodeView);
+    return found;
+}
+
 bool
 NodeEditorScene::removeConnection(
     std::shared_ptr<nodeeditor::core::presenter::ConnectionPathPresenter> connectionPtr)
@@ -138,7 +462,18 @@ NodeEditorScene::removeConnection(
     auto viewConn = dynamic_cast<nodeeditor::core::view::ConnectionPathView*>(viewBase);
 
     if (viewConn)
-        this->removeItem(viewConn);
+    {
+        if (m_groupMove.active)
+            endGroupMove();
+        m_spatialIndex.removeEdge(viewConn);
+        removeSelectable(viewConn);
+        detachNodeEdge(viewConn);
+        m_pendingBatch.erase(viewConn);
+        if (m_edgeLayer && m_edgeLayer->containsEdge(viewConn))
+            m_edgeLayer->removeEdge(viewConn);
+        else if (viewConn->scene() == this)
+            this->removeItem(viewConn);
+    }
 
     m_connections.erase(it);
 
@@ -157,17 +492,27 @@ NodeEditorScene::nodes() const
     return m_nodes;
 }
 
+const view::SpatialIndex&
+NodeEditorScene::spatialIndex() const
+{
+    return m_spatialIndex;
+}
+
+std::size_t
+NodeEditorScene::nodeCount() const
+{
+    return m_nodes.size() + m_parkedNodes.size();
+}
+
 std::shared_ptr<presenter::PortItemPresenter>
 NodeEditorScene::addInputPort(
     const QString& nodeId,
     const QString& portName,
     const QString& displayName)
 {
-    auto it = m_nodes.find(nodeId);
-    if (it == m_nodes.end())
+    auto nodePresenter = liveNode(nodeId);
+    if (!nodePresenter)
         return nullptr;
-
-    auto nodePresenter = it->second;
     auto nodeView = dynamic_cast<view::NodeItemView*>(nodePresenter->view().get());
     if (!nodeView)
         return nullptr;
@@ -178,19 +523,20 @@ NodeEditorScene::addInputPort(
     portModel->set_display_name(displayName.toStdString());
     portModel->set_orientation(common::utility::SPort::Orientation::Input);
 
-    auto portView = std::make_shared<view::PortItemView>(
+    auto portView = view::ViewPool<view::PortItemView>::instance().acquire(
         portName,
         displayName,
         nodeView->nodeName(),
         common::utility::SPort::Orientation::Input);
 
+    // Parents the port to the node; it joins the scene with it.
     nodeView->addPortView(portView);
 
     auto portPresenter = std::make_shared<presenter::PortItemPresenter>(portModel, portView);
 
     nodePresenter->addPortPresenter(portPresenter);
-
-    this->addItem(portView.get());
+    // Indexed now so it is pickable before the next frame lays it out.
+    m_spatialIndex.refreshNode(nodeView);
 
     return portPresenter;
 }
@@ -201,11 +547,9 @@ NodeEditorScene::addOutputPort(
     const QString& portName,
     const QString& displayName)
 {
-    auto it = m_nodes.find(nodeId);
-    if (it == m_nodes.end())
+    auto nodePresenter = liveNode(nodeId);
+    if (!nodePresenter)
         return nullptr;
-
-    auto nodePresenter = it->second;
     auto nodeView = dynamic_cast<view::NodeItemView*>(nodePresenter->view().get());
     if (!nodeView)
         return nullptr;
@@ -216,19 +560,19 @@ NodeEditorScene::addOutputPort(
     portModel->set_display_name(displayName.toStdString());
     portModel->set_orientation(common::utility::SPort::Orientation::Output);
 
-    auto portView = std::make_shared<view::PortItemView>(
+    auto portView = view::ViewPool<view::PortItemView>::instance().acquire(
         portName,
         displayName,
         nodeView->nodeName(),
         common::utility::SPort::Orientation::Output);
 
+    // Parents the port to the node; it joins the scene with it.
     nodeView->addPortView(portView);
 
     auto portPresenter = std::make_shared<presenter::PortItemPresenter>(portModel, portView);
 
     nodePresenter->addPortPresenter(portPresenter);
-
-    this->addItem(portView.get());
+    m_spatialIndex.refreshNode(nodeView);
 
     return portPresenter;
 }
@@ -238,27 +582,24 @@ NodeEditorScene::removePort(
     const QString& nodeId,
     const QString& portName)
 {
-    auto itNode = m_nodes.find(nodeId);
-    if (itNode == m_nodes.end())
+    auto nodePresenter = liveNode(nodeId);
+    if (!nodePresenter)
         return false;
-
-    auto nodePresenter = itNode->second;
     auto nodeView = dynamic_cast<view::NodeItemView*>(nodePresenter->view().get());
     if (!nodeView)
         return false;
 
-    std::shared_ptr<presenter::PortItemPresenter> portPresenter = nullptr;
-    for (auto& pp : nodePresenter->ports()) // assume NodeItemPresenter has ports() returning vector/shared_ptr
-    {
-        auto pView = dynamic_cast<view::PortItemView*>(pp->view().get());
-        if (pView && pView->name() == portName)
-        {
-            portPresenter = pp;
-            break;
-        }
-    }
-
+    const std::string name = portName.toStdString();
+    std::shared_ptr<presenter::PortItemPresenter> portPresenter = nodePresenter->getInputPort(name);
+    if (!portPresenter)
+        portPresenter = nodePresenter->getOutputPort(name);
     if (!portPresenter)
+        portPresenter = nodePresenter->getParameterPort(name);
+
+    const bool isRow = !portPresenter &&
+                       (nodeView->portTable().find(view::PortTable::Side::Input, portName).isValid() ||
+                        nodeView->portTable().find(view::PortTable::Side::Output, portName).isValid());
+    if (!portPresenter && !isRow)
         return false;
 
     std::vector<std::shared_ptr<nodeeditor::core::presenter::ConnectionPathPresenter>> connsToRemove;
@@ -273,35 +614,1100 @@ NodeEditorScene::removePort(
     for (auto& cid : connsToRemove)
         removeConnection(cid);
 
-    auto portView = dynamic_cast<view::PortItemView*>(portPresenter->view().get());
+    if (isRow)
+    {
+        nodeView->removeRow(view::PortTable::Side::Input, portName);
+        nodeView->removeRow(view::PortTable::Side::Output, portName);
+        return true;
+    }
+
+    auto portView = std::dynamic_pointer_cast<view::PortItemView>(portPresenter->view());
     if (portView)
-        this->removeItem(portView);
+    {
+        if (portView->isInputPort())
+            nodeView->removeInput(portView);
+        else if (portView->isOutputPort())
+            nodeView->removeOutput(portView);
+        else
+            nodeView->removeParamInput(portView);
+    }
+    if (portView && portView->scene() == this)
+    {
+        portView->setParentItem(nullptr);
+        this->removeItem(portView.get());
+    }
 
     nodePresenter->removePortPresenter(portPresenter);
+    m_spatialIndex.refreshNode(nodeView);
 
     return true;
 }
 
 void
-NodeEditorScene::mousePressEvent(QGraphicsSceneMouseEvent* event)
+NodeEditorScene::setEdgeBatchingEnabled(bool enabled)
 {
-    QGraphicsItem* clickedItem = itemAt(event->scenePos(), QTransform());
+    if (enabled == (m_edgeLayer != nullptr))
+        return;
 
-    if (clickedItem)
+    if (enabled)
     {
-        for (auto item : selectedItems())
+        m_edgeLayer = new view::EdgeLayerItem();
+        this->addItem(m_edgeLayer);
+        for (const auto& cp : m_connections)
         {
-            if (item != clickedItem)
-                item->setSelected(false);
+            auto* edge = dynamic_cast<view::ConnectionPathView*>(cp->view().get());
+            if (edge && isEdgeBatchable(edge))
+                batchEdge(edge);
         }
+        return;
+    }
 
-        clickedItem->setSelected(true);
+    m_pendingBatch.clear();
+    for (const auto& cp : m_connections)
+    {
+        auto* edge = dynamic_cast<view::ConnectionPathView*>(cp->view().get());
+        if (edge)
+            promoteEdge(edge);
     }
-    else
+    this->removeItem(m_edgeLayer);
+    delete m_edgeLayer;
+    m_edgeLayer = nullptr;
+}
+
+bool
+NodeEditorScene::edgeBatchingEnabled() const
+{
+    return m_edgeLayer != nullptr;
+}
+
+view::EdgeLayerItem*
+NodeEditorScene::edgeLayer() const
+{
+    return m_edgeLayer;
+}
+
+void
+NodeEditorScene::setNodeCacheMode(QGraphicsItem::CacheMode mode)
+{
+    if (mode == m_nodeCacheMode)
+        return;
+
+    m_nodeCacheMode = mode;
+    for (const auto& [name, presenter] : m_nodes)
     {
-        for (auto item : selectedItems())
-            item->setSelected(false);
+        if (auto* nodeView = dynamic_cast<view::NodeItemView*>(presenter->view().get()))
+            nodeView->setCacheMode(mode);
     }
+}
 
-    QGraphicsScene::mousePressEvent(event);
+void
+NodeEditorScene::invalidateNodeCaches()
+{
+    // Parked nodes are rebuilt from scratch and hold no pixmap.
+    if (m_nodeCacheMode == QGraphicsItem::NoCache)
+        return;
+    for (const auto& [name, presenter] : m_nodes)
+    {
+        if (auto* nodeView = dynamic_cast<view::NodeItemView*>(presenter->view().get()))
+            nodeView->update();
+    }
+}
+
+QGraphicsItem::CacheMode
+NodeEditorScene::nodeCacheMode() const
+{
+    return m_nodeCacheMode;
+}
+
+void
+NodeEditorScene::prefetchAround(const QRectF& visibleRect, const QPointF& panDelta, qreal pixelRatio)
+{
+    if (!view::NodeRasterizer::instance().isEnabled() || visibleRect.isEmpty())
+        return;
+
+    // Look a few frames ahead in the pan direction, plus a small margin all around.
+    constexpr qreal lookAheadFrames = 4.0;
+    const qreal margin = 0.25 * std::max(visibleRect.width(), visibleRect.height());
+    const QRectF ahead = visibleRect.translated(panDelta * lookAheadFrames)
+                             .united(visibleRect)
+                             .adjusted(-margin, -margin, margin, margin);
+
+    for (QGraphicsItem* item : items(ahead, Qt::IntersectsItemBoundingRect))
+    {
+        auto* node = dynamic_cast<view::NodeItemView*>(item);
+        if (node && !node->sceneBoundingRect().intersects(visibleRect))
+            node->prefetchBody(pixelRatio);
+    }
+}
+
+void
+NodeEditorScene::setVirtualizationEnabled(bool enabled, qreal margin)
+{
+    m_virtualMargin = std::max<qreal>(0.0, margin);
+    if (enabled == m_virtualized)
+        return;
+
+    m_virtualized = enabled;
+    if (enabled)
+    {
+        scheduleVirtualization();
+        return;
+    }
+
+    std::vector<QString> parked;
+    parked.reserve(m_parkedNodes.size());
+    for (const auto& [name, _] : m_parkedNodes)
+        parked.push_back(name);
+    for (const QString& name : parked)
+        materializeNode(name);
+}
+
+bool
+NodeEditorScene::virtualizationEnabled() const
+{
+    return m_virtualized;
+}
+
+void
+NodeEditorScene::updateViewport(const QRectF& visibleRect)
+{
+    m_viewportRect = visibleRect;
+    if (!m_virtualized || visibleRect.isEmpty())
+        return;
+
+    const qreal margin = m_virtualMargin;
+    const QRectF keep = visibleRect.adjusted(-margin, -margin, margin, margin);
+
+    std::vector<QString> entering;
+    m_parkedIndex.query(keep, [&entering](const QString& name, const QRectF&) { entering.push_back(name); });
+    for (const QString& name : entering)
+        materializeNode(name);
+
+    // Park with some slack so nodes sitting on the margin do not flip every frame.
+    const qreal slack = 0.5 * margin;
+    const QRectF release = keep.adjusted(-slack, -slack, slack, slack);
+
+    std::vector<QString> leaving;
+    for (const auto& [name, presenter] : m_nodes)
+    {
+        auto* nodeView = dynamic_cast<view::NodeItemView*>(presenter->view().get());
+        if (nodeView && !nodeView->sceneBoundingRect().intersects(release))
+            leaving.push_back(name);
+    }
+    for (const QString& name : leaving)
+        parkNode(name);
+}
+
+bool
+NodeEditorScene::isNodeMaterialized(const QString& nodeId) const
+{
+    return m_nodes.find(nodeId) != m_nodes.end();
+}
+
+std::shared_ptr<presenter::NodeItemPresenter>
+NodeEditorScene::liveNode(const QString& nodeId)
+{
+    auto it = m_nodes.find(nodeId);
+    return it != m_nodes.end() ? it->second : materializeNode(nodeId);
+}
+
+std::shared_ptr<presenter::NodeItemPresenter>
+NodeEditorScene::materializeNode(const QString& nodeId)
+{
+    auto live = m_nodes.find(nodeId);
+    if (live != m_nodes.end())
+        return live->second;
+
+    auto it = m_parkedNodes.find(nodeId);
+    if (it == m_parkedNodes.end())
+        return nullptr;
+
+    ParkedNode parked = std::move(it->second);
+    m_parkedNodes.erase(it);
+    m_parkedIndex.remove(nodeId);
+
+    const auto& pos = parked.model->pos();
+    auto nodeView = view::ViewPool<view::NodeItemView>::instance().acquire(nodeId, QString::fromStdString(parked.model->text()));
+    nodeView->setPos(pos.x, pos.y);
+    auto presenter = std::make_shared<presenter::NodeItemPresenter>(parked.model, nodeView);
+
+    for (const auto& row : parked.inputRows)
+    {
+        nodeView->addInputRow(row.name, row.displayName);
+        nodeView->setRowTags(view::PortTable::Side::Input, row.name, row.tags);
+    }
+    for (const auto& row : parked.outputRows)
+    {
+        nodeView->addOutputRow(row.name, row.displayName);
+        nodeView->setRowTags(view::PortTable::Side::Output, row.name, row.tags);
+    }
+    nodeView->setPortRowLimit(parked.portRowLimit);
+
+    for (const auto& param : parked.parameters)
+    {
+        if (auto* control = view::ParameterTypeRegistry::createControl(param.typeId))
+        {
+            control->setValue(param.value);
+            nodeView->addParameter(control, param.name, param.displayName);
+        }
+    }
+
+    // Link counts drive the collapsed-anchor markers of scrolled rows.
+    auto edgesIt = m_nodeEdges.find(nodeId);
+    if (edgesIt != m_nodeEdges.end())
+        for (const auto& end : edgesIt->second)
+            if (!end.rowName.isEmpty())
+                nodeView->linkRow(end.inputEnd ? view::PortTable::Side::Input : view::PortTable::Side::Output, end.rowName, 1);
+
+    attachNodeView(nodeId, nodeView.get(), parked.model);
+    this->addItem(nodeView.get());
+    m_nodes[nodeId] = presenter;
+
+    for (const auto& port : parked.inputPorts)
+        if (auto portPresenter = addInputPort(nodeId, port.name, port.displayName))
+            static_cast<view::PortItemView*>(portPresenter->view().get())->setTagBitMask(port.tags);
+    for (const auto& port : parked.outputPorts)
+        if (auto portPresenter = addOutputPort(nodeId, port.name, port.displayName))
+            static_cast<view::PortItemView*>(portPresenter->view().get())->setTagBitMask(port.tags);
+
+    if (edgesIt != m_nodeEdges.end())
+        for (auto& end : edgesIt->second)
+        {
+            if (end.portName.isEmpty())
+                continue;
+            // Either end may sit on either kind of port; prefer the usual one.
+            auto port = end.inputEnd ? nodeView->findInput(end.portName) : nodeView->findOutput(end.portName);
+            if (!port)
+                port = end.inputEnd ? nodeView->findOutput(end.portName) : nodeView->findInput(end.portName);
+            if (port)
+                bindPortEdge(end, port.get());
+        }
+
+    // Lays out now; rows_changed and the ports' pos_changed re-anchor the edges that stayed in place meanwhile.
+    nodeView->updateLayout();
+    return presenter;
+}
+
+bool
+NodeEditorScene::canPark(const QString& name) const
+{
+    auto it = m_nodes.find(name);
+    if (it == m_nodes.end())
+        return false;
+
+    auto* nodeView = dynamic_cast<view::NodeItemView*>(it->second->view().get());
+    if (!nodeView || nodeView->isSelected() || nodeView->liveRowPort())
+        return false;
+
+    for (const auto& port : nodeView->paramsInputs())
+    {
+        const auto* control = nodeView->getParameterControl(port);
+        if (!control || control->typeId() == 0 || control->isEditing())
+            return false;
+    }
+    return true;
+}
+
+bool
+NodeEditorScene::parkNode(const QString& name)
+{
+    if (!canPark(name))
+        return false;
+
+    auto it = m_nodes.find(name);
+    auto presenter = it->second;
+    auto* nodeView = static_cast<view::NodeItemView*>(presenter->view().get());
+    nodeView->flushLayout();
+
+    ParkedNode parked;
+    parked.model = std::dynamic_pointer_cast<model::NodeItemModel>(presenter->model());
+    if (!parked.model)
+        return false;
+
+    const auto& table = nodeView->portTable();
+    for (int i = 0; i < table.count(view::PortTable::Side::Input); ++i)
+    {
+        const auto& row = table.row({view::PortTable::Side::Input, i});
+        parked.inputRows.append({row.name, row.displayName, row.tags});
+    }
+    for (int i = 0; i < table.count(view::PortTable::Side::Output); ++i)
+    {
+        const auto& row = table.row({view::PortTable::Side::Output, i});
+        parked.outputRows.append({row.name, row.displayName, row.tags});
+    }
+    parked.portRowLimit = nodeView->portRowLimit();
+
+    // Their edges stay in the scene; materializeNode() binds them to the rebuilt ports.
+    for (const auto& port : nodeView->inputs())
+        parked.inputPorts.append({port->name(), port->displayName(), port->getTagBitMask()});
+    for (const auto& port : nodeView->outputs())
+        parked.outputPorts.append({port->name(), port->displayName(), port->getTagBitMask()});
+
+    for (const auto& port : nodeView->paramsInputs())
+    {
+        const auto* control = nodeView->getParameterControl(port);
+        parked.parameters.append({control->typeId(), port->name(), port->displayName(), control->value()});
+    }
+
+    m_parkedIndex.insert(name, nodeView->sceneBoundingRect());
+    m_parkedNodes.emplace(name, std::move(parked));
+    detachNodeView(nodeView);
+
+    this->removeItem(nodeView);
+    m_nodes.erase(it);
+    return true;
+}
+
+void
+NodeEditorScene::scheduleVirtualization()
+{
+    if (!m_virtualized || m_virtualizationPending)
+        return;
+
+    // Not on FrameScheduler: a flush there must never park a node a caller is holding.
+    m_virtualizationPending = true;
+    QTimer::singleShot(0, this, [this]() {
+        m_virtualizationPending = false;
+        updateViewport(m_viewportRect);
+    });
+}
+
+void
+NodeEditorScene::translateNodeEdges(const QString& nodeName, const QPointF& delta)
+{
+    auto it = m_nodeEdges.find(nodeName);
+    if (it == m_nodeEdges.end())
+        return;
+
+    auto& batch = view::EdgeGeometryBatch::instance();
+    for (const auto& end : it->second)
+    {
+        end.edge->shiftEnds(end.inputEnd ? delta : QPointF(), end.inputEnd ? QPointF() : delta);
+        batch.enqueue(end.edge);
+    }
+    // One flush per frame for every node moved in it, not one per node.
+    batch.scheduleFlush();
+}
+
+void
+NodeEditorScene::detachNodeEdge(view::ConnectionPathView* edge)
+{
+    auto it = m_edgeNodes.find(edge);
+    if (it == m_edgeNodes.end())
+        return;
+
+    for (const QString& nodeName : {it->second.first, it->second.second})
+    {
+        auto nodeIt = m_nodeEdges.find(nodeName);
+        if (nodeIt == m_nodeEdges.end())
+            continue;
+        auto& ends = nodeIt->second;
+
+        auto node = m_nodes.find(nodeName);
+        auto* nodeView = node != m_nodes.end() ? dynamic_cast<view::NodeItemView*>(node->second->view().get()) : nullptr;
+        for (auto& end : ends)
+        {
+            if (end.edge != edge)
+                continue;
+            unbindPortEdge(end);
+            if (nodeView && !end.rowName.isEmpty())
+                nodeView->linkRow(end.inputEnd ? view::PortTable::Side::Input : view::PortTable::Side::Output, end.rowName, -1);
+        }
+
+        ends.erase(std::remove_if(ends.begin(), ends.end(), [edge](const NodeEdgeEnd& e) { return e.edge == edge; }), ends.end());
+    }
+    m_edgeNodes.erase(it);
+}
+
+bool
+NodeEditorScene::isEdgeBatchable(const view::ConnectionPathView* edge) const
+{
+    return m_edgeLayer && edge && !edge->isSelected() && !edge->isActivated();
+}
+
+void
+NodeEditorScene::batchEdge(view::ConnectionPathView* edge)
+{
+    if (!m_edgeLayer || m_edgeLayer->containsEdge(edge))
+        return;
+    if (edge->scene() == this)
+        this->removeItem(edge);
+    m_edgeLayer->addEdge(edge);
+}
+
+void
+NodeEditorScene::promoteEdge(view::ConnectionPathView* edge)
+{
+    m_pendingBatch.erase(edge);
+    if (!m_edgeLayer || !m_edgeLayer->containsEdge(edge))
+        return;
+    m_edgeLayer->removeEdge(edge);
+    this->addItem(edge);
+}
+
+void
+NodeEditorScene::scheduleEdgeBatch(view::ConnectionPathView* edge)
+{
+    if (!m_edgeLayer)
+        return;
+
+    // Deferred: the edge is usually inside its own itemChange() when this fires.
+    const bool wasEmpty = m_pendingBatch.empty();
+    m_pendingBatch.insert(edge);
+    if (wasEmpty)
+        QTimer::singleShot(0, this, [this]() { flushEdgeBatch(); });
+}
+
+void
+NodeEditorScene::flushEdgeBatch()
+{
+    auto pending = std::move(m_pendingBatch);
+    m_pendingBatch.clear();
+    for (auto* edge : pending)
+        if (isEdgeBatchable(edge))
+            batchEdge(edge);
+}
+
+void
+NodeEditorScene::selectRect(const QRectF& rect, bool extend)
+{
+    std::vector<view::SelectionSet::Index> indices;
+    for (auto* node : m_spatialIndex.nodesIn(rect))
+    {
+        auto it = m_selectableIds.find(node);
+        if (it != m_selectableIds.end())
+            indices.push_back(it->second);
+    }
+    for (auto* edge : m_spatialIndex.edgesIn(rect))
+    {
+        auto it = m_selectableIds.find(edge);
+        if (it != m_selectableIds.end() && rect.contains(edge->sceneBoundingRect()))
+            indices.push_back(it->second);
+    }
+
+    applySelection(extend ? m_selection.add(indices) : m_selection.assign(indices));
+}
+
+void
+NodeEditorScene::selectAll()
+{
+    applySelection(m_selection.selectAll());
+}
+
+void
+NodeEditorScene::invertSelection()
+{
+    applySelection(m_selection.invert());
+}
+
+void
+NodeEditorScene::deselectAll()
+{
+    applySelection(m_selection.clear());
+}
+
+const view::SelectionSet&
+NodeEditorScene::selection() const
+{
+    return m_selection;
+}
+
+QGraphicsItem*
+NodeEditorScene::selectableItem(view::SelectionSet::Index index) const
+{
+    if (index >= m_selectables.size())
+        return nullptr;
+    const auto& entry = m_selectables[index];
+    if (entry.node)
+        return entry.node;
+    return entry.edge;
+}
+
+void
+NodeEditorScene::addSelectable(QGraphicsItem* item, const Selectable& selectable)
+{
+    if (m_selectableIds.count(item))
+        return;
+
+    const auto index = m_selection.acquire();
+    if (index >= m_selectables.size())
+        m_selectables.resize(index + 1);
+    m_selectables[index] = selectable;
+    m_selectableIds.emplace(item, index);
+
+    if (item->isSelected())
+        m_selection.select(index);
+}
+
+void
+NodeEditorScene::removeSelectable(QGraphicsItem* item)
+{
+    auto it = m_selectableIds.find(item);
+    if (it == m_selectableIds.end())
+        return;
+    m_selection.release(it->second);
+    m_selectables[it->second] = Selectable();
+    m_selectableIds.erase(it);
+}
+
+void
+NodeEditorScene::applySelection(const view::SelectionSet::Delta& delta)
+{
+    if (delta.isEmpty())
+        return;
+
+    {
+        // One selectionChanged() for the whole batch instead of one per item.
+        const QSignalBlocker blocker(this);
+        for (auto index : delta.deselected)
+            setSelectableSelected(index, false);
+        for (auto index : delta.selected)
+            setSelectableSelected(index, true);
+    }
+    pushSelectionToModels(delta);
+
+    emit selectionChanged();
+    selection_changed.notify(delta);
+}
+
+void
+NodeEditorScene::setSelectableSelected(view::SelectionSet::Index index, bool selected)
+{
+    const auto& entry = m_selectables[index];
+    if (entry.node)
+    {
+        entry.node->set_select_silently(selected);
+        return;
+    }
+    if (!entry.edge)
+        return;
+
+    // Selected edges are drawn as items of their own; the layer takes them back once idle.
+    if (selected)
+        promoteEdge(entry.edge);
+    entry.edge->set_select_silently(selected);
+    if (!selected)
+        scheduleEdgeBatch(entry.edge);
+}
+
+void
+NodeEditorScene::pushSelectionToModels(const view::SelectionSet::Delta& delta)
+{
+    // The views already match, so the presenters' model-to-view echo is a no-op.
+    const auto push = [this](view::SelectionSet::Index index, bool selected) {
+        const auto& entry = m_selectables[index];
+        if (auto nodeModel = entry.nodeModel.lock())
+            nodeModel->set_select(selected);
+        else if (auto edgeModel = entry.edgeModel.lock())
+            edgeModel->set_select(selected);
+    };
+    for (auto index : delta.deselected)
+        push(index, false);
+    for (auto index : delta.selected)
+        push(index, true);
+}
+
+void
+NodeEditorScene::syncItemSelection(QGraphicsItem* item, bool selected)
+{
+    auto it = m_selectableIds.find(item);
+    if (it == m_selectableIds.end())
+        return;
+    auto delta = m_selection.select(it->second, selected);
+    if (!delta.isEmpty())
+        selection_changed.notify(delta);
+}
+
+void
+NodeEditorScene::beginGroupMove()
+{
+    if (m_groupMove.active)
+        return;
+
+    GroupMove group;
+    std::unordered_set<QString> names;
+    m_selection.forEachSelected([&](view::SelectionSet::Index index) {
+        if (auto* node = m_selectables[index].node)
+        {
+            group.nodes.insert(node);
+            names.insert(node->nodeName());
+        }
+    });
+    if (group.nodes.empty())
+        return;
+
+    std::unordered_set<view::ConnectionPathView*> seen;
+    for (const QString& name : names)
+    {
+        auto it = m_nodeEdges.find(name);
+        if (it == m_nodeEdges.end())
+            continue;
+        for (const auto& end : it->second)
+        {
+            if (!seen.insert(end.edge).second)
+                continue;
+            const auto& [inputNode, outputNode] = m_edgeNodes[end.edge];
+            const bool inputMoves = names.count(inputNode) != 0;
+            const bool outputMoves = names.count(outputNode) != 0;
+            if (inputMoves && outputMoves)
+                group.internalEdges.push_back(end.edge);
+            else
+                group.boundaryEdges.emplace_back(end.edge, inputMoves);
+        }
+    }
+
+    group.active = true;
+    m_groupMove = std::move(group);
+
+    if (m_dragSnapshot && int(m_groupMove.nodes.size()) >= m_dragSnapshotMinNodes)
+        takeDragSnapshot();
+}
+
+void
+NodeEditorScene::moveGroup(const QPointF& delta)
+{
+    if (!m_groupMove.active || delta.isNull())
+        return;
+
+    if (m_groupMove.snapshot)
+    {
+        m_groupMove.snapshot->moveBy(delta.x(), delta.y());
+        m_groupMove.snapshotOffset += delta;
+    }
+    else
+    {
+        for (auto* node : m_groupMove.nodes)
+            node->moveBy(delta.x(), delta.y());
+        for (auto* edge : m_groupMove.internalEdges)
+            edge->translateRigidly(delta);
+    }
+
+    m_groupMove.pendingDelta += delta;
+    view::FrameScheduler::instance().post(&m_groupMove, [this]() { flushGroupMove(); });
+}
+
+void
+NodeEditorScene::flushGroupMove()
+{
+    const QPointF delta = std::exchange(m_groupMove.pendingDelta, QPointF());
+    if (delta.isNull())
+        return;
+    auto& batch = view::EdgeGeometryBatch::instance();
+    for (const auto& [edge, inputMoves] : m_groupMove.boundaryEdges)
+    {
+        edge->shiftEnds(inputMoves ? delta : QPointF(), inputMoves ? QPointF() : delta);
+        batch.enqueue(edge);
+    }
+    batch.flush();
+}
+
+void
+NodeEditorScene::endGroupMove()
+{
+    if (!m_groupMove.active)
+        return;
+    view::FrameScheduler::instance().cancel(&m_groupMove);
+    flushGroupMove();
+    commitDragSnapshot();
+    m_groupMove = GroupMove();
+}
+
+void
+NodeEditorScene::takeDragSnapshot()
+{
+    auto& group = m_groupMove;
+
+    std::vector<view::NodeItemView*> nodes(group.nodes.begin(), group.nodes.end());
+    std::sort(nodes.begin(), nodes.end(), [](auto* a, auto* b) { return a->zValue() < b->zValue(); });
+
+    QRectF bounds;
+    for (auto* node : nodes)
+        bounds |= node->mapRectToScene(node->boundingRect() | node->childrenBoundingRect());
+    for (auto* edge : group.internalEdges)
+        bounds |= edge->sceneBoundingRect();
+    if (bounds.isEmpty())
+        return;
+
+    // Match the pixels on screen, but cap the image: a soft drag beats a failed allocation.
+    qreal scale = 1.0;
+    if (!views().isEmpty())
+    {
+        const QGraphicsView* graphicsView = views().first();
+        scale = graphicsView->transform().m11() * graphicsView->devicePixelRatioF();
+    }
+    constexpr qreal maxPixels = 4096.0 * 4096.0;
+    const qreal pixels = bounds.width() * bounds.height() * scale * scale;
+    if (pixels > maxPixels)
+        scale *= std::sqrt(maxPixels / pixels);
+
+    // Batched edges are painted by the layer; take them out so they can be hidden.
+    for (auto* edge : group.internalEdges)
+        promoteEdge(edge);
+
+    QPixmap pixmap((bounds.size() * scale).toSize().expandedTo(QSize(1, 1)));
+    pixmap.fill(Qt::transparent);
+    {
+        QPainter painter(&pixmap);
+        painter.setRenderHint(QPainter::Antialiasing, true);
+        const QTransform toImage = QTransform::fromTranslate(-bounds.left(), -bounds.top()) * QTransform::fromScale(scale, scale);
+        for (auto* edge : group.internalEdges)
+            paintItemTree(&painter, edge, toImage);
+        for (auto* node : nodes)
+            paintItemTree(&painter, node, toImage);
+    }
+    pixmap.setDevicePixelRatio(scale);
+
+    // Transparent items are skipped by the scene's paint pass but keep their mouse grab and selection.
+    for (auto* edge : group.internalEdges)
+        group.hiddenItems.emplace_back(edge, edge->opacity());
+    for (auto* node : nodes)
+        group.hiddenItems.emplace_back(node, node->opacity());
+    for (const auto& [item, opacity] : group.hiddenItems)
+        item->setOpacity(0.0);
+
+    group.snapshot = new QGraphicsPixmapItem(pixmap);
+    group.snapshot->setOffset(bounds.topLeft());
+    group.snapshot->setTransformationMode(Qt::SmoothTransformation);
+    group.snapshot->setAcceptedMouseButtons(Qt::NoButton);
+    group.snapshot->setZValue(nodes.back()->zValue() + 1);
+    this->addItem(group.snapshot);
+}
+
+void
+NodeEditorScene::commitDragSnapshot()
+{
+    auto& group = m_groupMove;
+    if (!group.snapshot)
+        return;
+
+    this->removeItem(group.snapshot);
+    delete group.snapshot;
+    group.snapshot = nullptr;
+
+    // Boundary edges already follow; moved_by leaves them alone while the group is active.
+    const QPointF delta = std::exchange(group.snapshotOffset, QPointF());
+    if (!delta.isNull())
+    {
+        for (auto* node : group.nodes)
+            node->moveBy(delta.x(), delta.y());
+        for (auto* edge : group.internalEdges)
+            edge->translateRigidly(delta);
+    }
+
+    for (const auto& [item, opacity] : group.hiddenItems)
+        item->setOpacity(opacity);
+    group.hiddenItems.clear();
+
+    for (auto* edge : group.internalEdges)
+        scheduleEdgeBatch(edge);
+}
+
+void
+NodeEditorScene::setDragSnapshotEnabled(bool enabled, int minNodes)
+{
+    m_dragSnapshot = enabled;
+    m_dragSnapshotMinNodes = std::max(1, minNodes);
+}
+
+bool
+NodeEditorScene::dragSnapshotEnabled() const
+{
+    return m_dragSnapshot;
+}
+
+bool
+NodeEditorScene::isGroupMoving() const
+{
+    return m_groupMove.active;
+}
+
+QGraphicsItem*
+NodeEditorScene::pickItem(const QPointF& scenePos)
+{
+    // Ports, then node bodies; an edge only wins on empty canvas, where a
+    // stray curve passing over a node must not steal the press.
+    auto* node = m_spatialIndex.nodeAt(scenePos);
+    for (const auto& hit : m_spatialIndex.portsWithin(scenePos, PortPickRadius))
+    {
+        // A port under another node's body is hidden by it.
+        if (node && hit.node != node)
+            continue;
+        auto port = hit.side == view::PortTable::Side::Input ? hit.node->findInput(hit.name) : hit.node->findOutput(hit.name);
+        if (!port)
+        {
+            auto live = hit.node->liveRowPort();
+            if (live && live->name() == hit.name)
+                port = live;
+        }
+        if (port)
+            return port.get();
+    }
+    if (node)
+        return node;
+
+    constexpr qreal edgePickRadius = 5.0;
+    if (auto* edge = m_spatialIndex.nearestEdge(scenePos, edgePickRadius))
+    {
+        promoteEdge(edge);
+        return edge;
+    }
+    return nullptr;
+}
+
+void
+NodeEditorScene::mousePressEvent(QGraphicsSceneMouseEvent* event)
+{
+    if (event->button() == Qt::LeftButton)
+        beginConnectionDrag(event->scenePos());
+
+    QGraphicsItem* clickedItem = pickItem(event->scenePos());
+
+    m_pressedNode = nullptr;
+    auto clicked = clickedItem ? m_selectableIds.find(clickedItem) : m_selectableIds.end();
+    if (clicked != m_selectableIds.end())
+    {
+        // Pressing a selected node keeps the selection so it can be dragged as a group.
+        if (!m_selection.isSelected(clicked->second))
+            applySelection(m_selection.assign({clicked->second}));
+
+        auto* node = m_selectables[clicked->second].node;
+        if (node && event->button() == Qt::LeftButton && !m_connectionDrag.armed)
+        {
+            m_pressedNode = node;
+            m_lastDragPos = event->scenePos();
+        }
+    }
+    else
+    {
+        applySelection(m_selection.clear());
+        if (clickedItem)
+            clickedItem->setSelected(true);
+    }
+
+    // Only items outside the selection set (ports) are left; there are a handful at most.
+    for (auto item : selectedItems())
+    {
+        if (item != clickedItem && !m_selectableIds.count(item))
+            item->setSelected(false);
+    }
+
+    QGraphicsScene::mousePressEvent(event);
+}
+
+void
+NodeEditorScene::mouseMoveEvent(QGraphicsSceneMouseEvent* event)
+{
+    auto& drag = m_connectionDrag;
+    if (drag.armed && !drag.preview &&
+        QLineF(drag.pressPos, event->scenePos()).length() >= QApplication::startDragDistance())
+    {
+        // The press went to the port; release its grab so the node does not move along.
+        if (auto* grabber = mouseGrabberItem())
+            grabber->ungrabMouse();
+
+        const QRectF& rect = drag.source.rect;
+        ConnectionPortData port{rect.topLeft(), QRectF(QPointF(), rect.size()), drag.source.name,
+                                drag.source.node->nodeName(), drag.source.side == view::PortTable::Side::Input};
+        drag.preview = view::ViewPool<view::ConnectionPathView>::instance().acquire(port);
+        this->addItem(drag.preview.get());
+    }
+
+    // Move the selection ourselves instead of letting every item move itself.
+    const bool nodeDrag = m_pressedNode && (event->buttons() & Qt::LeftButton) &&
+                          (m_pressedNode->flags() & QGraphicsItem::ItemIsMovable);
+    if (drag.preview || nodeDrag)
+    {
+        queueDragMove(event->scenePos());
+        event->accept();
+        return;
+    }
+
+    QGraphicsScene::mouseMoveEvent(event);
+}
+
+void
+NodeEditorScene::mouseReleaseEvent(QGraphicsSceneMouseEvent* event)
+{
+    // Land exactly where the pointer was last seen.
+    applyDragMove();
+
+    if (event->button() == Qt::LeftButton && m_connectionDrag.armed)
+    {
+        const bool dragging = m_connectionDrag.preview != nullptr;
+        finishConnectionDrag();
+        if (dragging)
+        {
+            event->accept();
+            return;
+        }
+    }
+
+    if (event->button() == Qt::LeftButton && m_pressedNode)
+    {
+        auto* node = std::exchange(m_pressedNode, nullptr);
+        if (m_groupMove.active)
+        {
+            endGroupMove();
+        }
+        else if (auto it = m_selectableIds.find(node); it != m_selectableIds.end())
+        {
+            // A click without a drag keeps only the clicked node, as Qt would, but in one pass.
+            applySelection(m_selection.assign({it->second}));
+        }
+
+        // Handled: Qt's item release would clear and reselect item by item.
+        // Only the grab it would have ended is left to undo.
+        if (auto* grabber = mouseGrabberItem())
+            grabber->ungrabMouse();
+        event->accept();
+        return;
+    }
+
+    QGraphicsScene::mouseReleaseEvent(event);
+}
+
+void
+NodeEditorScene::queueDragMove(const QPointF& scenePos)
+{
+    const qint64 now = m_inputClock.nsecsElapsed();
+    if (m_pendingMove.pending)
+    {
+        ++m_dragLatency.coalesced;
+    }
+    else
+    {
+        m_pendingMove.pending = true;
+        m_pendingMove.receivedNs = now;
+    }
+    m_pendingMove.scenePos = scenePos;
+
+    if (now - m_pendingMove.receivedNs >= m_latencyBudgetNs)
+    {
+        view::FrameScheduler::instance().cancel(&m_pendingMove);
+        applyDragMove();
+        return;
+    }
+    view::FrameScheduler::instance().post(&m_pendingMove, [this]() { applyDragMove(); });
+}
+
+void
+NodeEditorScene::applyDragMove()
+{
+    if (!m_pendingMove.pending)
+        return;
+    view::FrameScheduler::instance().cancel(&m_pendingMove);
+
+    const PendingMove move = std::exchange(m_pendingMove, PendingMove());
+    if (m_connectionDrag.preview)
+    {
+        updateConnectionDrag(move.scenePos);
+    }
+    else if (m_pressedNode)
+    {
+        if (!m_groupMove.active)
+            beginGroupMove();
+        moveGroup(move.scenePos - m_lastDragPos);
+        m_lastDragPos = move.scenePos;
+    }
+
+    // An earlier move still waiting for its paint keeps the older timestamp.
+    if (m_awaitingPaintNs < 0)
+        m_awaitingPaintNs = move.receivedNs;
+}
+
+void
+NodeEditorScene::drawForeground(QPainter* painter, const QRectF& rect)
+{
+    QGraphicsScene::drawForeground(painter, rect);
+
+    if (m_awaitingPaintNs < 0)
+        return;
+    const qint64 latency = m_inputClock.nsecsElapsed() - std::exchange(m_awaitingPaintNs, -1);
+    ++m_dragLatency.samples;
+    m_dragLatency.lastNs = latency;
+    m_dragLatency.maxNs = std::max(m_dragLatency.maxNs, latency);
+    m_dragLatency.totalNs += latency;
+}
+
+const NodeEditorScene::DragLatency&
+NodeEditorScene::dragLatency() const
+{
+    return m_dragLatency;
+}
+
+void
+NodeEditorScene::resetDragLatency()
+{
+    m_dragLatency = DragLatency();
+}
+
+void
+NodeEditorScene::setDragLatencyBudget(int milliseconds)
+{
+    m_latencyBudgetNs = qint64(std::max(0, milliseconds)) * 1'000'000;
+}
+
+int
+NodeEditorScene::dragLatencyBudget() const
+{
+    return int(m_latencyBudgetNs / 1'000'000);
+}
+
+bool
+NodeEditorScene::beginConnectionDrag(const QPointF& scenePos)
+{
+    m_connectionDrag = ConnectionDrag();
+
+    // Same slack and stacking as pickItem(), so the port it picks is the one that drags.
+    auto* node = m_spatialIndex.nodeAt(scenePos);
+    for (const auto& hit : m_spatialIndex.portsWithin(scenePos, PortPickRadius))
+    {
+        if (node && hit.node != node)
+            continue;
+        m_connectionDrag.armed = true;
+        m_connectionDrag.source = hit;
+        m_connectionDrag.pressPos = scenePos;
+        return true;
+    }
+    return false;
+}
+
+void
+NodeEditorScene::updateConnectionDrag(const QPointF& scenePos)
+{
+    constexpr qreal snapRadius = 32.0;
+
+    auto& drag = m_connectionDrag;
+    drag.target = m_spatialIndex.nearestCompatiblePort(scenePos, drag.source, snapRadius);
+
+    if (!drag.target)
+    {
+        drag.preview->updateEndPoint(scenePos);
+        drag.preview->setIsCompatible(false);
+        return;
+    }
+
+    // Same attach points as a finished connection: inputs on the left edge, outputs on the right.
+    const QRectF& rect = drag.target->rect;
+    const qreal x = drag.target->side == view::PortTable::Side::Input ? rect.left() : rect.right();
+    drag.preview->updateEndPoint(QPointF(x, rect.center().y() - 3));
+    drag.preview->setIsCompatible(true);
+}
+
+void
+NodeEditorScene::finishConnectionDrag()
+{
+    ConnectionDrag drag = std::move(m_connectionDrag);
+    m_connectionDrag = ConnectionDrag();
+
+    // Back to the pool; the recycler takes it out of the scene.
+    drag.preview.reset();
+
+    if (!drag.target)
+        return;
+
+    const bool sourceIsInput = drag.source.side == view::PortTable::Side::Input;
+    const auto& in = sourceIsInput ? drag.source : *drag.target;
+    const auto& out = sourceIsInput ? *drag.target : drag.source;
+    createConnection(in.node->nodeName(), in.name, out.node->nodeName(), out.name);
 }
@@ -1,95 +1,988 @@
-// /*
-//     MIT License
-
-//     Copyright (c) 2025 Joseph Al Hajjar
-
-//     Permission is hereby granted, free of charge, to any person obtaining a copy
-//     of this software and associated documentation files (the "Software"), to deal
-//     in the Software without restriction, including without limitation the rights
-//     to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-//     copies of the Software, and to permit persons to whom the Software is
-//     furnished to do so, subject to the following conditions:
-
-//     The above copyright notice and this permission notice shall be included in
-//     all copies or substantial portions of the Software.
-
-//     THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-//     IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-//     FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-//     AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-//     LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-//     THE SOFTWARE.
-// */
-
-// #include "core/view/GraphView.hpp"
-// #include "core/view/GraphScene.hpp"
-
-// #include <QKeyEvent>
-// #include <QWheelEvent>
-// #include <QtGlobal>
-
-// GraphView::GraphView(GraphScene* scene, QWidget* parent)
-//     : QGraphicsView(parent)
-// {
-//     setScene(scene);
-//     setRenderHint(QPainter::Antialiasing);
-//     setTransformationAnchor(AnchorUnderMouse);
-//     setResizeAnchor(AnchorUnderMouse);
-//     setViewportUpdateMode(FullViewportUpdate);
-//     setCacheMode(CacheNone);
-
-//     setDragMode(RubberBandDrag);
-
-//     // Hide scrollbars
-//     setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-//     setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-// }
-
-// void
-// GraphView::wheelEvent(QWheelEvent* event)
-// {
-//     constexpr qreal zoomFactor = 1.15;
-
-//     QPointF delta = event->angleDelta();
-
-//     if (delta.y() == 0)
-//     {
-//         event->ignore();
-//         return;
-//     }
-
-//     qreal factor = (delta.y() > 0) ? zoomFactor : 1.0 / zoomFactor;
-
-//     // Clamp zoom level
-//     if (qreal currentScale = transform().m11();
-//         (factor > 1.0 && currentScale < 5.0) ||
-//         (factor < 1.0 && currentScale > 0.1))
-//         scale(factor, factor);
-
-//     event->accept();
-// }
-
-// void
-// GraphView::keyPressEvent(QKeyEvent* event)
-// {
-//     if (event->key() == Qt::Key_Control)
-//     {
-//         setDragMode(ScrollHandDrag);
-//         setCursor(Qt::CrossCursor);
-//         return;
-//     }
-//     QGraphicsView::keyPressEvent(event);
-// }
-
-// void
-// GraphView::keyReleaseEvent(QKeyEvent* event)
-// {
-//     if (event->key() == Qt::Key_Control)
-//     {
-//         setDragMode(RubberBandDrag);
-//         unsetCursor();
-//         return;
-//     }
-//     QGraphicsView::keyReleaseEvent(event);
-// }
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/GraphView.hpp"
+#include "core/view/FrameScheduler.hpp"
+#include "core/view/GraphScene.hpp"
+
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QPainterPath>
+#include <QResizeEvent>
+#include <QRubberBand>
+#include <QScrollBar>
+#include <QElapsedTimer>
+#include <QWheelEvent>
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+#include <utility>
+
+namespace
+{
+    constexpr qreal ZoomStep = 1.15;      ///< Scale change per wheel notch.
+    constexpr qreal SceneExtent = 1.0e6;  ///< Half-size of the pannable area.
+    constexpr qreal MinTilePixels = 8.0;  ///< Below this the grid is a flat fill.
+    constexpr qreal MinMinorPixels = 4.0; ///< Below this minor lines are left out.
+    constexpr int MaxTilePixels = 2048;
+    constexpr int RefineTilePixels = 256; ///< Edge of a progressive refinement tile.
+
+    // Adaptive update thresholds, as <enter, leave> pairs around the current mode.
+    constexpr qreal FullCoverageEnter = 0.6;
+    constexpr qreal FullCoverageLeave = 0.35;
+    constexpr qreal FullScrollEnter = 0.6;
+    constexpr qreal FullScrollLeave = 0.35;
+    constexpr qreal ScatteredRectsEnter = 8.0;
+    constexpr qreal ScatteredRectsLeave = 4.0;
+    constexpr qreal CachePanEnter = 0.5;
+    constexpr qreal CachePanLeave = 0.25;
+    constexpr int ConfirmWindows = 2; ///< Windows a new choice must win in a row.
+
+    qreal
+    positiveMod(qreal value, qreal period)
+    {
+        const qreal r = std::fmod(value, period);
+        return r < 0.0 ? r + period : r;
+    }
+} // namespace
+
+namespace nodeeditor::core::view
+{
+    GraphView::GraphView(NodeEditorScene* scene, QWidget* parent)
+        : QGraphicsView(parent)
+    {
+        setScene(scene);
+        setRenderHint(QPainter::Antialiasing);
+        setTransformationAnchor(NoAnchor); // zoomBy() keeps its own anchor.
+        setResizeAnchor(AnchorViewCenter);
+
+        // Repaint the bounding rect of what changed; scrolling blits the viewport
+        // and only paints the uncovered strip, from the cached background.
+        setViewportUpdateMode(BoundingRectViewportUpdate);
+        setCacheMode(CacheBackground);
+
+        // Left drags on empty canvas draw the view's own rubber band.
+        setDragMode(NoDrag);
+
+        // Hide scrollbars
+        setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+        setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+
+        // Scrolling is clamped to the scene rect; make it large enough to pan freely.
+        setSceneRect(-SceneExtent, -SceneExtent, 2 * SceneExtent, 2 * SceneExtent);
+
+        m_zoomSettleTimer.setSingleShot(true);
+        m_zoomSettleTimer.setInterval(150);
+        connect(&m_zoomSettleTimer, &QTimer::timeout, this, [this]() { endZoomGesture(); });
+    }
+
+    GraphView::~GraphView()
+    {
+        FrameScheduler::instance().cancel(this);
+        FrameScheduler::instance().cancel(&m_strategy);
+        FrameScheduler::instance().cancel(&m_pass);
+        FrameScheduler::instance().cancel(&m_frameTimes);
+        restoreNodeCache();
+    }
+
+    qreal
+    GraphView::zoom() const
+    {
+        return m_zoom;
+    }
+
+    void
+    GraphView::zoomBy(qreal factor, const QPointF& viewPos)
+    {
+        const qreal target = std::clamp(m_zoom * factor, m_minZoom, m_maxZoom);
+        if (qFuzzyCompare(target, m_zoom))
+            return;
+
+        m_zoomedSinceFrame = true;
+        const QPointF anchor = mapToScene(viewPos.toPoint());
+        const qreal applied = target / m_zoom;
+        scale(applied, applied);
+        m_zoom = target;
+
+        // Bring the anchor back under the cursor.
+        const QPoint drift = mapFromScene(anchor) - viewPos.toPoint();
+        horizontalScrollBar()->setValue(horizontalScrollBar()->value() + drift.x());
+        verticalScrollBar()->setValue(verticalScrollBar()->value() + drift.y());
+
+        scheduleViewportSync();
+        viewportChanged();
+    }
+
+    void
+    GraphView::setZoomRange(qreal minimum, qreal maximum)
+    {
+        m_minZoom = std::max<qreal>(minimum, 1e-3);
+        m_maxZoom = std::max(maximum, m_minZoom);
+
+        const qreal clamped = std::clamp(m_zoom, m_minZoom, m_maxZoom);
+        if (clamped != m_zoom)
+            zoomBy(clamped / m_zoom, viewport()->rect().center());
+    }
+
+    qreal
+    GraphView::minimumZoom() const
+    {
+        return m_minZoom;
+    }
+
+    qreal
+    GraphView::maximumZoom() const
+    {
+        return m_maxZoom;
+    }
+
+    void
+    GraphView::setZoomSnapshotEnabled(bool enabled, int settleMilliseconds)
+    {
+        m_zoomSettleTimer.setInterval(std::max(0, settleMilliseconds));
+        m_zoomSnapshot = enabled;
+        if (!enabled)
+            endZoomGesture();
+    }
+
+    bool
+    GraphView::zoomSnapshotEnabled() const
+    {
+        return m_zoomSnapshot;
+    }
+
+    bool
+    GraphView::isZoomGestureActive() const
+    {
+        return m_zoomGesture.active;
+    }
+
+    void
+    GraphView::setProgressiveRenderingEnabled(bool enabled, int budgetMilliseconds)
+    {
+        m_paintBudgetNs = qint64(std::max(1, budgetMilliseconds)) * 1'000'000;
+        if (enabled == m_progressive)
+            return;
+
+        m_progressive = enabled;
+        if (!enabled && m_pass.active)
+        {
+            FrameScheduler::instance().cancel(&m_pass);
+            m_pass = ProgressivePass();
+            restoreNodeCache();
+            viewport()->update();
+        }
+    }
+
+    bool
+    GraphView::progressiveRenderingEnabled() const
+    {
+        return m_progressive;
+    }
+
+    bool
+    GraphView::isRefining() const
+    {
+        return m_pass.active;
+    }
+
+    qint64
+    GraphView::fullFrameNs() const
+    {
+        return m_fullFrameNs;
+    }
+
+    void
+    GraphView::setFrameGovernorEnabled(bool enabled, qreal targetMilliseconds, int windowFrames)
+    {
+        m_frameTargetNs = qint64(std::max<qreal>(targetMilliseconds, 1.0) * 1'000'000);
+        m_governorFrames = std::max(1, windowFrames);
+        m_frameTimes.clear();
+        m_frameTimeSum = 0;
+        FrameScheduler::instance().cancel(&m_frameTimes);
+        m_pendingFrameNs = 0;
+        m_pendingFrameArea = 0;
+        if (enabled == m_governor)
+            return;
+
+        m_governor = enabled;
+        if (!enabled)
+            setQuality(RenderQuality::Full, QStringLiteral("frame governor disabled"));
+    }
+
+    bool
+    GraphView::frameGovernorEnabled() const
+    {
+        return m_governor;
+    }
+
+    qint64
+    GraphView::averageFrameNs() const
+    {
+        return m_frameTimes.empty() ? 0 : m_frameTimeSum / qint64(m_frameTimes.size());
+    }
+
+    RenderQuality::Level
+    GraphView::qualityLevel() const
+    {
+        return RenderQuality::instance().level();
+    }
+
+    QString
+    GraphView::qualityReason() const
+    {
+        return RenderQuality::instance().reason();
+    }
+
+    void
+    GraphView::setGrid(qreal spacing, int majorEvery)
+    {
+        m_gridSpacing = spacing;
+        m_gridMajorEvery = std::max(1, majorEvery);
+        clearGridCache();
+    }
+
+    qreal
+    GraphView::gridSpacing() const
+    {
+        return m_gridSpacing;
+    }
+
+    void
+    GraphView::setGridVisible(bool visible)
+    {
+        if (visible == m_gridVisible)
+            return;
+        m_gridVisible = visible;
+        resetCachedContent();
+        viewport()->update();
+    }
+
+    bool
+    GraphView::isGridVisible() const
+    {
+        return m_gridVisible;
+    }
+
+    void
+    GraphView::setGridColors(const QColor& background, const QColor& minor, const QColor& major)
+    {
+        m_gridBackground = background;
+        m_gridMinor = minor;
+        m_gridMajor = major;
+        clearGridCache();
+    }
+
+    void
+    GraphView::clearGridCache()
+    {
+        m_gridTiles.clear();
+        m_gridLru.clear();
+        resetCachedContent();
+        viewport()->update();
+    }
+
+    const GraphView::RepaintStats&
+    GraphView::repaintStats() const
+    {
+        return m_repaintStats;
+    }
+
+    void
+    GraphView::resetRepaintStats()
+    {
+        m_repaintStats = RepaintStats();
+    }
+
+    void
+    GraphView::setAdaptiveUpdatesEnabled(bool enabled, int windowFrames)
+    {
+        m_windowFrames = std::max(1, windowFrames);
+        if (enabled == m_adaptive)
+            return;
+
+        m_adaptive = enabled;
+        m_sums = WindowSums();
+        m_window = UpdateWindow();
+        m_candidateWins = 0;
+        FrameScheduler::instance().cancel(&m_strategy);
+        if (!enabled)
+        {
+            UpdateStrategy defaults;
+            defaults.switches = m_strategy.switches;
+            applyStrategy(defaults);
+        }
+    }
+
+    bool
+    GraphView::adaptiveUpdatesEnabled() const
+    {
+        return m_adaptive;
+    }
+
+    const GraphView::UpdateStrategy&
+    GraphView::updateStrategy() const
+    {
+        return m_strategy;
+    }
+
+    const GraphView::UpdateWindow&
+    GraphView::updateWindow() const
+    {
+        return m_window;
+    }
+
+    void
+    GraphView::drawBackground(QPainter* painter, const QRectF& rect)
+    {
+        if (!m_gridVisible || m_gridSpacing <= 0.0)
+        {
+            QGraphicsView::drawBackground(painter, rect);
+            return;
+        }
+
+        const qreal ratio = m_zoom * devicePixelRatioF();
+        const qreal period = m_gridSpacing * m_gridMajorEvery;
+        if (period * ratio < MinTilePixels)
+        {
+            painter->fillRect(rect, m_gridBackground);
+            return;
+        }
+
+        // The tile's logical size is one major cell in scene units, so the offset
+        // keeps every exposed strip aligned on the same lattice.
+        const QPointF offset(positiveMod(rect.left(), period), positiveMod(rect.top(), period));
+        painter->drawTiledPixmap(rect, gridTile(ratio), offset);
+    }
+
+    void
+    GraphView::paintEvent(QPaintEvent* event)
+    {
+        qint64 area = 0;
+        for (const QRect& r : event->region())
+            area += qint64(r.width()) * r.height();
+
+        const qint64 full = qint64(viewport()->width()) * viewport()->height();
+        ++m_repaintStats.frames;
+        if (area >= full)
+            ++m_repaintStats.fullFrames;
+        m_repaintStats.lastArea = area;
+        m_repaintStats.totalArea += std::min(area, full);
+        m_repaintStats.viewportArea += full;
+        m_repaintStats.lastRects = event->region().rectCount();
+
+        if (m_zoomGesture.active)
+        {
+            ++m_repaintStats.snapshotFrames;
+            paintZoomSnapshot(event);
+            return;
+        }
+
+        // The pass paints its own tiles at its level. Other updates (animated
+        // edges, hover) inside tiles already done keep that level, so they
+        // neither flicker nor queue the tiles again; anything reaching outside
+        // the done area drops one level and requeues the overlap. The done
+        // area only grows within a level, so the pass always converges.
+        PaintDetail::Level detail = PaintDetail::Full;
+        if (m_pass.active && (m_refining || (event->region() - m_pass.done).isEmpty()))
+            detail = m_pass.level;
+        else if (m_pass.active)
+        {
+            detail = PaintDetail::Level(m_pass.level - 1);
+            m_pass.redo += event->region() & m_pass.done;
+        }
+
+        {
+            PaintDetail::Scope scope(detail);
+            QElapsedTimer timer;
+            timer.start();
+            QGraphicsView::paintEvent(event);
+            const qint64 paintNs = timer.nsecsElapsed();
+            if (!m_pass.active && area >= full)
+                m_fullFrameNs = paintNs;
+            // Tiles of a progressive pass are budgeted already; they are not frames.
+            if (m_governor && !m_refining)
+                recordFramePaint(paintNs, area, full);
+        }
+
+        if (m_adaptive)
+            sampleFrame(event->region(), area, full);
+        m_scrolledSinceFrame = false;
+        m_zoomedSinceFrame = false;
+    }
+
+    void
+    GraphView::resizeEvent(QResizeEvent* event)
+    {
+        endZoomGesture();
+        QGraphicsView::resizeEvent(event);
+        scheduleViewportSync();
+        viewportChanged();
+    }
+
+    void
+    GraphView::scrollContentsBy(int dx, int dy)
+    {
+        QGraphicsView::scrollContentsBy(dx, dy);
+        m_scrolledSinceFrame = true;
+        scheduleViewportSync();
+        viewportChanged();
+    }
+
+    void
+    GraphView::wheelEvent(QWheelEvent* event)
+    {
+        const int delta = event->angleDelta().y();
+        if (delta == 0)
+        {
+            event->ignore();
+            return;
+        }
+
+        if (m_zoomSnapshot)
+        {
+            beginZoomGesture();
+            m_zoomSettleTimer.start();
+        }
+
+        // Fractional notches from touchpads zoom proportionally.
+        zoomBy(std::pow(ZoomStep, delta / 120.0), event->position());
+        event->accept();
+    }
+
+    void
+    GraphView::mousePressEvent(QMouseEvent* event)
+    {
+        // Picking and dragging need the real items on screen.
+        endZoomGesture();
+
+        if (event->button() == Qt::MiddleButton)
+        {
+            m_panning = true;
+            m_panOrigin = event->pos();
+            viewport()->setCursor(Qt::ClosedHandCursor);
+            event->accept();
+            return;
+        }
+        QGraphicsView::mousePressEvent(event);
+
+        // Nothing took the press: start a rubber band.
+        if (event->button() == Qt::LeftButton && dragMode() == NoDrag && scene() && !scene()->mouseGrabberItem())
+        {
+            m_banding = true;
+            m_bandOrigin = event->pos();
+            if (!m_rubberBand)
+                m_rubberBand = new QRubberBand(QRubberBand::Rectangle, viewport());
+            m_rubberBand->setGeometry(QRect(m_bandOrigin, QSize()));
+            m_rubberBand->show();
+        }
+    }
+
+    void
+    GraphView::mouseMoveEvent(QMouseEvent* event)
+    {
+        if (m_panning)
+        {
+            const QPoint delta = event->pos() - m_panOrigin;
+            m_panOrigin = event->pos();
+            horizontalScrollBar()->setValue(horizontalScrollBar()->value() - delta.x());
+            verticalScrollBar()->setValue(verticalScrollBar()->value() - delta.y());
+            event->accept();
+            return;
+        }
+        if (m_banding)
+        {
+            updateRubberBand(event->pos());
+            event->accept();
+            return;
+        }
+        QGraphicsView::mouseMoveEvent(event);
+    }
+
+    void
+    GraphView::mouseReleaseEvent(QMouseEvent* event)
+    {
+        if (m_panning && event->button() == Qt::MiddleButton)
+        {
+            m_panning = false;
+            viewport()->unsetCursor();
+            event->accept();
+            return;
+        }
+        if (m_banding && event->button() == Qt::LeftButton)
+        {
+            updateRubberBand(event->pos());
+            m_banding = false;
+            m_rubberBand->hide();
+        }
+        QGraphicsView::mouseReleaseEvent(event);
+    }
+
+    void
+    GraphView::updateRubberBand(const QPoint& pos)
+    {
+        const QRect band = QRect(m_bandOrigin, pos).normalized();
+        m_rubberBand->setGeometry(band);
+
+        const QRectF sceneRect = mapToScene(band).boundingRect();
+        if (NodeEditorScene* graphScene = nodeScene())
+            graphScene->selectRect(sceneRect);
+        else if (scene())
+        {
+            QPainterPath area;
+            area.addRect(sceneRect);
+            scene()->setSelectionArea(area);
+        }
+    }
+
+    void
+    GraphView::keyPressEvent(QKeyEvent* event)
+    {
+        if (event->key() == Qt::Key_Control)
+        {
+            setDragMode(ScrollHandDrag);
+            return;
+        }
+        QGraphicsView::keyPressEvent(event);
+    }
+
+    void
+    GraphView::keyReleaseEvent(QKeyEvent* event)
+    {
+        if (event->key() == Qt::Key_Control)
+        {
+            setDragMode(NoDrag);
+            return;
+        }
+        QGraphicsView::keyReleaseEvent(event);
+    }
+
+    void
+    GraphView::beginZoomGesture()
+    {
+        if (m_zoomGesture.active)
+            return;
+
+        // Grab before activating, so this one frame still renders the scene.
+        m_zoomGesture.snapshot = viewport()->grab();
+        m_zoomGesture.sceneRect = viewportTransform().inverted().mapRect(QRectF(viewport()->rect()));
+        m_zoomGesture.active = true;
+    }
+
+    void
+    GraphView::endZoomGesture()
+    {
+        m_zoomSettleTimer.stop();
+        if (!m_zoomGesture.active)
+            return;
+
+        m_zoomGesture = ZoomGesture();
+        viewport()->update();
+        scheduleViewportSync();
+        viewportChanged();
+    }
+
+    void
+    GraphView::paintZoomSnapshot(QPaintEvent* event)
+    {
+        QPainter painter(viewport());
+        painter.setClipRegion(event->region());
+        painter.setTransform(viewportTransform());
+
+        // The grid is tiled, so it stays sharp and covers what the snapshot does not.
+        drawBackground(&painter, mapToScene(event->region().boundingRect()).boundingRect());
+        painter.drawPixmap(m_zoomGesture.sceneRect, m_zoomGesture.snapshot, QRectF(m_zoomGesture.snapshot.rect()));
+    }
+
+    void
+    GraphView::viewportChanged()
+    {
+        // Zoom gestures paint from their snapshot; the pass starts once they settle.
+        if (!m_progressive || m_zoomGesture.active)
+            return;
+        if (m_pass.active || m_fullFrameNs > m_paintBudgetNs)
+            startProgressivePass();
+    }
+
+    void
+    GraphView::startProgressivePass()
+    {
+        // Any pass in flight refers to the old viewport: drop it.
+        m_pass = ProgressivePass();
+        m_pass.active = true;
+        m_pass.tiles = progressiveTiles();
+        suspendNodeCache();
+
+        // The next regular paint covers the whole viewport at Bounds, one below the pass level.
+        viewport()->update();
+        FrameScheduler::instance().post(&m_pass, [this]() { refineProgressivePass(); });
+    }
+
+    void
+    GraphView::refineProgressivePass()
+    {
+        if (!m_pass.active)
+            return;
+
+        QElapsedTimer timer;
+        timer.start();
+        while (true)
+        {
+            if (m_pass.next == m_pass.tiles.size())
+            {
+                if (!m_pass.redo.isEmpty())
+                {
+                    for (const QRect& r : std::exchange(m_pass.redo, QRegion()))
+                        m_pass.tiles.push_back(r);
+                    continue;
+                }
+                if (m_pass.level == PaintDetail::Full)
+                {
+                    m_fullFrameNs = m_pass.fullNs;
+                    m_pass = ProgressivePass();
+                    restoreNodeCache();
+                    return;
+                }
+                m_pass.level = PaintDetail::Level(m_pass.level + 1);
+                m_pass.tiles = progressiveTiles();
+                m_pass.next = 0;
+                m_pass.done = QRegion();
+            }
+
+            const QRect tile = m_pass.tiles[m_pass.next++];
+            const qint64 start = timer.nsecsElapsed();
+            m_refining = true;
+            viewport()->repaint(tile);
+            m_refining = false;
+            m_pass.done += tile;
+            if (m_pass.level == PaintDetail::Full)
+                m_pass.fullNs += timer.nsecsElapsed() - start;
+
+            if (timer.nsecsElapsed() >= m_paintBudgetNs)
+                break;
+        }
+
+        FrameScheduler::instance().post(&m_pass, [this]() { refineProgressivePass(); });
+    }
+
+    void
+    GraphView::suspendNodeCache()
+    {
+        NodeEditorScene* graphScene = nodeScene();
+        if (m_cacheSuspended || !graphScene || graphScene->nodeCacheMode() == QGraphicsItem::NoCache)
+            return;
+        m_cacheBeforePass = graphScene->nodeCacheMode();
+        m_cacheSuspended = true;
+        graphScene->setNodeCacheMode(QGraphicsItem::NoCache);
+    }
+
+    void
+    GraphView::restoreNodeCache()
+    {
+        if (!m_cacheSuspended)
+            return;
+        m_cacheSuspended = false;
+        if (NodeEditorScene* graphScene = nodeScene())
+            graphScene->setNodeCacheMode(m_cacheBeforePass);
+    }
+
+    std::vector<QRect>
+    GraphView::progressiveTiles() const
+    {
+        const QRect area = viewport()->rect();
+        std::vector<QRect> tiles;
+        for (int y = area.top(); y <= area.bottom(); y += RefineTilePixels)
+        {
+            for (int x = area.left(); x <= area.right(); x += RefineTilePixels)
+                tiles.push_back(QRect(x, y, RefineTilePixels, RefineTilePixels) & area);
+        }
+
+        const QPoint centre = area.center();
+        std::sort(tiles.begin(), tiles.end(), [&centre](const QRect& a, const QRect& b) {
+            return (a.center() - centre).manhattanLength() < (b.center() - centre).manhattanLength();
+        });
+        return tiles;
+    }
+
+    void
+    GraphView::recordFramePaint(qint64 paintNs, qint64 area, qint64 full)
+    {
+        m_pendingFrameNs += paintNs;
+        m_pendingFrameArea += std::min(area, full);
+        FrameScheduler::instance().post(&m_frameTimes, [this, full]() {
+            const qint64 ns = std::exchange(m_pendingFrameNs, 0);
+            const qint64 frameArea = std::exchange(m_pendingFrameArea, 0);
+            // Hover and animation updates are cheap because they are small, not because the scene is.
+            if (full > 0 && qreal(frameArea) >= GovernorMinCoverage * qreal(full))
+                governFrame(ns);
+        });
+    }
+
+    void
+    GraphView::governFrame(qint64 paintNs)
+    {
+        m_frameTimes.push_back(paintNs);
+        m_frameTimeSum += paintNs;
+        if (int(m_frameTimes.size()) > m_governorFrames)
+        {
+            m_frameTimeSum -= m_frameTimes.front();
+            m_frameTimes.pop_front();
+        }
+        if (int(m_frameTimes.size()) < m_governorFrames)
+            return;
+
+        const qint64 average = averageFrameNs();
+        const RenderQuality::Level level = RenderQuality::instance().level();
+        const QString stats = QStringLiteral("average paint %1 ms over %2 frames")
+                                  .arg(average / 1e6, 0, 'f', 1)
+                                  .arg(int(m_frameTimes.size()));
+
+        if (average > m_frameTargetNs && level < RenderQuality::Lowest)
+            setQuality(RenderQuality::Level(level + 1),
+                       stats + QStringLiteral(" above the %1 ms target").arg(m_frameTargetNs / 1e6, 0, 'f', 1));
+        else if (average < m_frameTargetNs / 2 && level > RenderQuality::Full)
+            setQuality(RenderQuality::Level(level - 1),
+                       stats + QStringLiteral(" below half the %1 ms target").arg(m_frameTargetNs / 1e6, 0, 'f', 1));
+    }
+
+    void
+    GraphView::setQuality(RenderQuality::Level level, const QString& reason)
+    {
+        RenderQuality& quality = RenderQuality::instance();
+        if (level == quality.level())
+            return;
+
+        quality.setLevel(level, reason);
+
+        // Measure the new level from scratch.
+        m_frameTimes.clear();
+        m_frameTimeSum = 0;
+        FrameScheduler::instance().cancel(&m_frameTimes);
+        m_pendingFrameNs = 0;
+        m_pendingFrameArea = 0;
+
+        // Cached node pixmaps hold the old row labels, off screen ones included.
+        if (NodeEditorScene* graphScene = nodeScene())
+            graphScene->invalidateNodeCaches();
+        viewport()->update();
+    }
+
+    void
+    GraphView::sampleFrame(const QRegion& region, qint64 area, qint64 full)
+    {
+        // Only the exposed rects, through the spatial index; the bounding rect of
+        // a scattered region would count everything between its pieces.
+        int items = 0;
+        if (const NodeEditorScene* graphScene = nodeScene())
+        {
+            const SpatialIndex& index = graphScene->spatialIndex();
+            std::unordered_set<const void*> seen;
+            for (const QRect& r : region)
+            {
+                const QRectF sceneRect = mapToScene(r).boundingRect();
+                for (const NodeItemView* node : index.nodesIn(sceneRect))
+                    seen.insert(node);
+                for (const ConnectionPathView* edge : index.edgesIn(sceneRect))
+                    seen.insert(edge);
+            }
+            items = int(seen.size());
+        }
+        else
+            items = int(this->items(region, Qt::IntersectsItemBoundingRect).size());
+        m_repaintStats.lastItems = items;
+
+        ++m_sums.frames;
+        m_sums.coverage += full ? qreal(std::min(area, full)) / qreal(full) : 0.0;
+        m_sums.rects += region.rectCount();
+        m_sums.items += items;
+        m_sums.scrolled += m_scrolledSinceFrame ? 1 : 0;
+        m_sums.zoomed += m_zoomedSinceFrame ? 1 : 0;
+
+        if (m_sums.frames < m_windowFrames)
+            return;
+
+        const qreal n = m_sums.frames;
+        m_window.frames = m_sums.frames;
+        m_window.coverage = m_sums.coverage / n;
+        m_window.rects = m_sums.rects / n;
+        m_window.items = m_sums.items / n;
+        m_window.scrollShare = m_sums.scrolled / n;
+        m_window.zoomShare = m_sums.zoomed / n;
+        m_sums = WindowSums();
+
+        adaptStrategy();
+    }
+
+    void
+    GraphView::adaptStrategy()
+    {
+        const UpdateWindow& w = m_window;
+        const bool isFull = m_strategy.viewportMode == FullViewportUpdate;
+        const bool isBounding = m_strategy.viewportMode == BoundingRectViewportUpdate;
+        const bool isCached = m_strategy.nodeCache == QGraphicsItem::DeviceCoordinateCache;
+
+        UpdateStrategy next = m_strategy;
+        if (w.coverage >= (isFull ? FullCoverageLeave : FullCoverageEnter) ||
+            w.scrollShare >= (isFull ? FullScrollLeave : FullScrollEnter))
+            next.viewportMode = FullViewportUpdate;
+        else if (w.rects >= (isBounding ? ScatteredRectsLeave : ScatteredRectsEnter))
+            next.viewportMode = BoundingRectViewportUpdate;
+        else
+            next.viewportMode = MinimalViewportUpdate;
+
+        // Device caches are only reused under pure translation.
+        const bool panning = w.zoomShare == 0.0 && w.scrollShare >= (isCached ? CachePanLeave : CachePanEnter);
+        next.nodeCache = panning ? QGraphicsItem::DeviceCoordinateCache : QGraphicsItem::NoCache;
+
+        if (next.viewportMode == m_strategy.viewportMode && next.nodeCache == m_strategy.nodeCache)
+        {
+            m_candidateWins = 0;
+            return;
+        }
+
+        const bool sameCandidate = m_candidateWins > 0 && next.viewportMode == m_candidate.viewportMode &&
+                                   next.nodeCache == m_candidate.nodeCache;
+        m_candidate = next;
+        m_candidateWins = sameCandidate ? m_candidateWins + 1 : 1;
+        if (m_candidateWins < ConfirmWindows)
+            return;
+
+        m_candidateWins = 0;
+        ++next.switches;
+        // Item cache changes repaint the items; keep them out of the paint event.
+        FrameScheduler::instance().post(&m_strategy, [this, next]() {
+            applyStrategy(next);
+            strategy_changed.notify(m_strategy);
+        });
+    }
+
+    void
+    GraphView::applyStrategy(const UpdateStrategy& strategy)
+    {
+        const bool cacheChanged = strategy.nodeCache != m_strategy.nodeCache;
+        m_strategy = strategy;
+        setViewportUpdateMode(strategy.viewportMode);
+        if (cacheChanged && m_cacheSuspended)
+            m_cacheBeforePass = strategy.nodeCache; // Applied when the pass ends.
+        else if (cacheChanged)
+        {
+            if (NodeEditorScene* graphScene = nodeScene())
+                graphScene->setNodeCacheMode(strategy.nodeCache);
+        }
+    }
+
+    const QPixmap&
+    GraphView::gridTile(qreal pixelRatio)
+    {
+        const int level = gridLevel(pixelRatio);
+        auto it = m_gridTiles.find(level);
+        if (it != m_gridTiles.end())
+        {
+            m_gridLru.remove(level);
+            m_gridLru.push_front(level);
+            return it->second;
+        }
+
+        if (m_gridTiles.size() >= std::size_t(MaxGridTiles))
+        {
+            m_gridTiles.erase(m_gridLru.back());
+            m_gridLru.pop_back();
+        }
+
+        // Render at the level's ratio, not the exact one, so nearby zooms share the tile.
+        const qreal period = m_gridSpacing * m_gridMajorEvery;
+        const qreal levelRatio = std::exp2(level / 8.0);
+        const int size = std::clamp(int(std::ceil(period * levelRatio)), 1, MaxTilePixels);
+        const qreal density = size / period;
+
+        QPixmap tile(size, size);
+        tile.fill(m_gridBackground);
+        {
+            QPainter painter(&tile);
+            QPen pen(m_gridMinor);
+            pen.setCosmetic(true);
+
+            if (m_gridSpacing * density >= MinMinorPixels)
+            {
+                painter.setPen(pen);
+                for (int i = 1; i < m_gridMajorEvery; ++i)
+                {
+                    const qreal p = i * m_gridSpacing * density;
+                    painter.drawLine(QLineF(p, 0, p, size));
+                    painter.drawLine(QLineF(0, p, size, p));
+                }
+            }
+
+            pen.setColor(m_gridMajor);
+            painter.setPen(pen);
+            painter.drawLine(QLineF(0, 0, 0, size));
+            painter.drawLine(QLineF(0, 0, size, 0));
+        }
+        tile.setDevicePixelRatio(density);
+
+        m_gridLru.push_front(level);
+        return m_gridTiles.emplace(level, std::move(tile)).first->second;
+    }
+
+    int
+    GraphView::gridLevel(qreal pixelRatio)
+    {
+        return qRound(std::log2(std::max<qreal>(pixelRatio, 1e-3)) * 8.0);
+    }
+
+    void
+    GraphView::scheduleViewportSync()
+    {
+        // Deferred to the end of a zoom gesture, see endZoomGesture().
+        if (!nodeScene() || m_zoomGesture.active)
+            return;
+        FrameScheduler::instance().post(this, [this]() { syncViewport(); });
+    }
+
+    void
+    GraphView::syncViewport()
+    {
+        NodeEditorScene* graphScene = nodeScene();
+        if (!graphScene)
+            return;
+
+        const QRectF visible = mapToScene(viewport()->rect()).boundingRect();
+        if (visible == m_reportedRect)
+            return;
+
+        const QPointF panDelta = m_reportedRect.isEmpty() ? QPointF() : visible.center() - m_reportedRect.center();
+        m_reportedRect = visible;
+
+        graphScene->updateViewport(visible);
+        graphScene->prefetchAround(visible, panDelta, m_zoom * devicePixelRatioF());
+    }
+
+    NodeEditorScene*
+    GraphView::nodeScene() const
+    {
+        return qobject_cast<NodeEditorScene*>(scene());
+    }
+} // namespace nodeeditor::core::view
@@ -1,11 +1,20 @@
 ﻿#include "core/view/NodeItemView.hpp"
 #include "core/view/EditableArrowItemView.hpp"
+#include "core/view/FrameScheduler.hpp"
+#include "core/view/NodeRasterizer.hpp"
+#include "core/view/PaintDetail.hpp"
+#include "core/view/ParameterControl.hpp"
 #include "core/view/PortItemView.hpp"
+#include "core/view/ViewPool.hpp"
 
 #include <QDebug>
 #include <QGraphicsProxyWidget>
+#include <QGraphicsScene>
+#include <QGraphicsSceneHoverEvent>
+#include <QGraphicsSceneWheelEvent>
 #include <QLinearGradient>
 #include <QPainter>
+#include <QStyleOptionGraphicsItem>
 #include <algorithm>
 #include <cmath>
 #include <utility>
@@ -27,9 +36,10 @@ namespace nodeeditor::core::view
         m_titleHeight = m_nodeNameLabel->boundingRect().height();
 
         m_nodeNameLabel->setOnTextChanged([this](const QString& t) { set_text(t.toStdString()); });
-        pos_changed.connect([this](const common::utility::SPos&) { updateLayout(); });
+        trackMoves();
         setFlags(ItemIsMovable | ItemIsSelectable);
         setFlag(ItemSendsGeometryChanges, true);
+        setFlag(ItemUsesExtendedStyleOption, true);
         setAcceptHoverEvents(true);
 
         updateLayout();
@@ -44,6 +54,17 @@ namespace nodeeditor::core::view
 
     NodeItemView::~NodeItemView()
     {
+        NodeRasterizer::instance().forget(this);
+        FrameScheduler::instance().cancel(this);
+        FrameScheduler::instance().cancel(&m_liveRow);
+        if (m_liveRowPort)
+            m_liveRowPort->setParentItem(nullptr);
+
+        // Ports are shared_ptr-owned; keep ~QGraphicsItem from deleting them.
+        for (const auto& port : getAllPorts())
+            if (port && port->parentItem() == this)
+                port->setParentItem(nullptr);
+
         try
         {
             disconnectAllPorts();
@@ -54,26 +75,83 @@ namespace nodeeditor::core::view
         }
     }
 
+    void NodeItemView::trackMoves()
+    {
+        // Ports are children, so a move needs no layout work; just report the delta.
+        pos_changed.connect([this](const common::utility::SPos& p) {
+            const QPointF current(p.x, p.y);
+            const QPointF delta = current - m_lastPos;
+            m_lastPos = current;
+            if (!delta.isNull())
+                moved_by.notify(delta);
+        });
+    }
+
+    void NodeItemView::recycle()
+    {
+        releaseLiveRow();
+        NodeRasterizer::instance().forget(this);
+        FrameScheduler::instance().cancel(this);
+
+        for (const auto& port : getAllPorts())
+            if (port && port->parentItem() == this)
+                port->setParentItem(nullptr);
+        disconnectAllPorts();
+
+        m_portTable = PortTable();
+        m_inputOffsets.clear();
+        m_outputOffsets.clear();
+        m_paramOffsets.clear();
+
+        if (m_nodeNameLabel->isEditing())
+            m_nodeNameLabel->finishEditing();
+
+        resetViewConnections();
+        rows_changed.disconnectAll();
+        layout_changed.disconnectAll();
+        text_changed.disconnectAll();
+        moved_by.disconnectAll();
+    }
+
+    void NodeItemView::resetForReuse(QString nodeName, const QString& nodeDisplayedName, QGraphicsItem* parent)
+    {
+        setParentItem(parent);
+        setVisible(true);
+        setOpacity(1.0);
+        setPos(0, 0);
+        m_lastPos = QPointF();
+
+        m_nodeName = std::move(nodeName);
+        m_displayedNodeName = nodeDisplayedName.isEmpty() ? m_nodeName : nodeDisplayedName;
+        m_nodeNameColor = Qt::blue;
+        m_nodeNameLabel->set_text(m_displayedNodeName.toStdString());
+
+        trackMoves();
+        updateLayout();
+    }
+
     // ----------------------
     // ADD PORTS
     // ----------------------
     std::shared_ptr<PortItemView> NodeItemView::addInput(const QString& name)
     {
-        auto input = std::make_shared<PortItemView>(name, m_nodeName, common::utility::SPort::Orientation::Input, this);
+        auto input = ViewPool<PortItemView>::instance().acquire(name, name, m_nodeName, common::utility::SPort::Orientation::Input, this);
         input->setColor(Qt::gray);
-        input->display_name_changed.connect([this](const std::string&) { updateLayout(); });
+        input->display_name_changed.connect([this](const std::string&) { requestMeasure(); });
         m_inputs.append(input);
-        updateLayout();
+        m_inputIndex.insert(name, input);
+        requestMeasure();
         return input;
     }
 
     std::shared_ptr<PortItemView> NodeItemView::addOutput(const QString& name)
     {
-        auto output = std::make_shared<PortItemView>(name, m_nodeName, common::utility::SPort::Orientation::Output, this);
+        auto output = ViewPool<PortItemView>::instance().acquire(name, name, m_nodeName, common::utility::SPort::Orientation::Output, this);
         output->setColor(Qt::gray);
-        output->display_name_changed.connect([this](const std::string&) { updateLayout(); });
+        output->display_name_changed.connect([this](const std::string&) { requestMeasure(); });
         m_outputs.append(output);
-        updateLayout();
+        m_outputIndex.insert(name, output);
+        requestMeasure();
         return output;
     }
 
@@ -95,10 +173,10 @@ namespace nodeeditor::core::view
 
     std::shared_ptr<PortItemView> NodeItemView::addParamInput(const QString& name)
     {
-        auto input = std::make_shared<PortItemView>(name, m_nodeName, common::utility::SPort::Orientation::Parameter, this);
+        auto input = ViewPool<PortItemView>::instance().acquire(name, name, m_nodeName, common::utility::SPort::Orientation::Parameter, this);
         input->setColor(Qt::gray);
-        input->display_name_changed.connect([this](const std::string&) { updateLayout(); });
-        updateLayout();
+        input->display_name_changed.connect([this](const std::string&) { requestMeasure(); });
+        requestMeasure();
         return input;
     }
 
@@ -111,10 +189,29 @@ namespace nodeeditor::core::view
         m_parameterWidgets.insert(widget, proxy);
         auto port = addParamInput(name);
         m_parameterPorts.insert(port, proxy);
-        updateLayout();
+        requestMeasure();
+        return port;
+    }
+
+    std::shared_ptr<PortItemView> NodeItemView::addParameter(ParameterControl* control, const QString& name, const QString& displayName)
+    {
+        if (control == nullptr)
+            return nullptr;
+        control->setParentItem(this);
+        auto port = addParamInput(name);
+        m_parameterPorts.insert(port, nullptr);
+        m_parameterControls.insert(port, control);
+        if (!displayName.isEmpty())
+            port->setDisplayName(displayName);
+        requestMeasure();
         return port;
     }
 
+    ParameterControl* NodeItemView::getParameterControl(const std::shared_ptr<PortItemView>& port) const
+    {
+        return m_parameterControls.value(port, nullptr);
+    }
+
     std::shared_ptr<PortItemView> NodeItemView::addParameter(QWidget* widget, const QString& name, const QString& displayName)
     {
         auto port = addParameter(widget, name);
@@ -128,18 +225,18 @@ namespace nodeeditor::core::view
     // ----------------------
     void NodeItemView::removeInput(const std::shared_ptr<PortItemView>& input)
     {
-        if (!m_inputs.contains(input))
+        if (!input || !m_inputs.removeOne(input))
             return;
-        m_inputs.removeOne(input);
-        updateLayout();
+        m_inputIndex.remove(input->name());
+        requestMeasure();
     }
 
     void NodeItemView::removeOutput(const std::shared_ptr<PortItemView>& output)
     {
-        if (!m_outputs.contains(output))
+        if (!output || !m_outputs.removeOne(output))
             return;
-        m_outputs.removeOne(output);
-        updateLayout();
+        m_outputIndex.remove(output->name());
+        requestMeasure();
     }
 
     void NodeItemView::removeParamInput(const std::shared_ptr<PortItemView>& input)
@@ -147,35 +244,30 @@ namespace nodeeditor::core::view
         if (!m_parameterPorts.contains(input))
             return;
         auto* proxy = m_parameterPorts.value(input);
-        auto* widget = m_parameterWidgets.key(proxy);
         m_parameterPorts.remove(input);
-        m_parameterWidgets.remove(widget);
-        proxy->deleteLater();
-        updateLayout();
+        if (proxy != nullptr)
+        {
+            m_parameterWidgets.remove(m_parameterWidgets.key(proxy));
+            proxy->deleteLater();
+        }
+        delete m_parameterControls.take(input);
+        requestMeasure();
     }
 
     void NodeItemView::removeInput(const QString& name)
     {
-        for (auto& port : m_inputs)
-        {
-            if (port && port->name() == name)
-            {
-                removeInput(port);
-                break;
-            }
-        }
+        if (auto port = findInput(name))
+            removeInput(port);
+        else
+            removeRow(PortTable::Side::Input, name);
     }
 
     void NodeItemView::removeOutput(const QString& name)
     {
-        for (auto& port : m_outputs)
-        {
-            if (port && port->name() == name)
-            {
-                removeOutput(port);
-                break;
-            }
-        }
+        if (auto port = findOutput(name))
+            removeOutput(port);
+        else
+            removeRow(PortTable::Side::Output, name);
     }
 
     void NodeItemView::removeParamInput(const QString& name)
@@ -202,6 +294,15 @@ namespace nodeeditor::core::view
         return all;
     }
 
+    std::shared_ptr<PortItemView> NodeItemView::findInput(const QString& name) const { return m_inputIndex.value(name); }
+    std::shared_ptr<PortItemView> NodeItemView::findOutput(const QString& name) const { return m_outputIndex.value(name); }
+
+    int NodeItemView::portCount() const
+    {
+        return m_inputs.size() + m_outputs.size() + m_parameterPorts.size() +
+               m_portTable.count(PortTable::Side::Input) + m_portTable.count(PortTable::Side::Output);
+    }
+
     QVector<std::shared_ptr<PortItemView>> NodeItemView::inputs() const { return m_inputs; }
     QVector<std::shared_ptr<PortItemView>> NodeItemView::outputs() const { return m_outputs; }
     QMap<QWidget*, QGraphicsProxyWidget*> NodeItemView::parameterWidgets() const { return m_parameterWidgets; }
@@ -224,13 +325,17 @@ namespace nodeeditor::core::view
         if (!port)
             return nullptr;
 
+        port->setParentItem(this);
+
         if (port->isInputPort())
         {
             m_inputs.append(port);
+            m_inputIndex.insert(port->name(), port);
         }
         else if (port->isOutputPort())
         {
             m_outputs.append(port);
+            m_outputIndex.insert(port->name(), port);
         }
         else if (port->isParameterPort())
         {
@@ -248,7 +353,7 @@ namespace nodeeditor::core::view
             return nullptr;
         }
 
-        updateLayout();
+        requestMeasure();
         return port;
     }
 
@@ -258,7 +363,7 @@ namespace nodeeditor::core::view
         if (m_nodeNameLabel != nullptr)
             m_nodeNameLabel->set_text(t.toStdString());
         m_titleHeight = m_nodeNameLabel->boundingRect().height();
-        updateLayout();
+        requestMeasure();
     }
 
     QString NodeItemView::displayedNodeName() const { return m_displayedNodeName; }
@@ -270,11 +375,236 @@ namespace nodeeditor::core::view
         update();
     }
 
+    // ----------------------
+    // COMPACT PORT ROWS
+    // ----------------------
+    bool NodeItemView::addInputRow(const QString& name, const QString& displayName)
+    {
+        return addRow(PortTable::Side::Input, name, displayName);
+    }
+
+    bool NodeItemView::addOutputRow(const QString& name, const QString& displayName)
+    {
+        return addRow(PortTable::Side::Output, name, displayName);
+    }
+
+    bool NodeItemView::addRow(PortTable::Side side, const QString& name, const QString& displayName)
+    {
+        if (m_portTable.find(side, name).isValid())
+            return false;
+        m_portTable.append(side, name, displayName);
+        requestMeasure();
+        return true;
+    }
+
+    bool NodeItemView::removeRow(PortTable::Side side, const QString& name)
+    {
+        // Indices shift on removal, so drop any stand-in item first.
+        if (m_liveRowPort)
+            releaseLiveRow();
+        if (!m_portTable.remove(side, name))
+            return false;
+        requestMeasure();
+        return true;
+    }
+
+    void NodeItemView::setPortRowLimit(int rows)
+    {
+        if (m_portTable.maxVisibleRows() == rows)
+            return;
+        if (m_liveRowPort)
+            releaseLiveRow();
+        m_portTable.setMaxVisibleRows(rows);
+        requestMeasure();
+    }
+
+    int NodeItemView::portRowLimit() const { return m_portTable.maxVisibleRows(); }
+
+    void NodeItemView::scrollPortRows(int rows)
+    {
+        const int previous = m_portTable.scrollOffset();
+        m_portTable.setScrollOffset(previous + rows);
+        if (m_portTable.scrollOffset() == previous)
+            return;
+
+        // Row indices under the cursor changed; the stand-in no longer matches.
+        if (m_liveRowPort && canReleaseLiveRow())
+            releaseLiveRow();
+        update();
+        rows_changed.notify();
+    }
+
+    void NodeItemView::linkRow(PortTable::Side side, const QString& name, int delta)
+    {
+        const auto ref = m_portTable.find(side, name);
+        if (!ref.isValid())
+            return;
+        m_portTable.addLinks(ref, delta);
+        if (!m_portTable.isRowVisible(ref))
+            update(m_portTable.rowRect(ref));
+    }
+
+    bool NodeItemView::setRowTags(PortTable::Side side, const QString& name, const common::taggable::TagBitMask& tags)
+    {
+        const auto ref = m_portTable.find(side, name);
+        if (!ref.isValid())
+            return false;
+        m_portTable.setTags(ref, tags);
+        if (m_liveRowPort && m_liveRow == ref)
+            m_liveRowPort->setTagBitMask(tags);
+        return true;
+    }
+
+    const PortTable& NodeItemView::portTable() const { return m_portTable; }
+    std::shared_ptr<PortItemView> NodeItemView::liveRowPort() const { return m_liveRowPort; }
+
+    bool NodeItemView::rowSceneRect(PortTable::Side side, const QString& name, QRectF* rect) const
+    {
+        const auto ref = m_portTable.find(side, name);
+        if (!ref.isValid())
+            return false;
+        if (rect)
+            *rect = mapRectToScene(m_portTable.rowRect(ref));
+        return true;
+    }
+
+    void NodeItemView::hoverMoveEvent(QGraphicsSceneHoverEvent* event)
+    {
+        common::view::AbstractItemView::hoverMoveEvent(event);
+        if (m_portTable.isEmpty())
+            return;
+
+        const auto ref = m_portTable.hitTest(event->pos());
+        if (ref == m_liveRow || !canReleaseLiveRow())
+            return;
+
+        releaseLiveRow();
+        if (ref.isValid())
+            materializeRow(ref);
+    }
+
+    void NodeItemView::wheelEvent(QGraphicsSceneWheelEvent* event)
+    {
+        const bool virtualized = m_portTable.isVirtualized(PortTable::Side::Input) ||
+                                 m_portTable.isVirtualized(PortTable::Side::Output);
+        if (!virtualized || event->pos().y() < m_titleHeight)
+        {
+            // Let the view zoom.
+            event->ignore();
+            return;
+        }
+
+        constexpr int rowsPerNotch = 3;
+        scrollPortRows(-event->delta() / 120 * rowsPerNotch);
+        event->accept();
+    }
+
+    void NodeItemView::hoverLeaveEvent(QGraphicsSceneHoverEvent* event)
+    {
+        common::view::AbstractItemView::hoverLeaveEvent(event);
+        scheduleLiveRowRelease();
+    }
+
+    void NodeItemView::materializeRow(const PortTable::RowRef& ref)
+    {
+        const auto& row = m_portTable.row(ref);
+        const auto orientation = ref.side == PortTable::Side::Input ? common::utility::SPort::Orientation::Input
+                                                                    : common::utility::SPort::Orientation::Output;
+
+        auto port = ViewPool<PortItemView>::instance().acquire(row.name, row.displayName, m_nodeName, orientation, this);
+        port->setColor(QColor::fromRgba(row.color));
+        port->setTagBitMask(row.tags);
+        port->setPos(m_portTable.rowRect(ref).topLeft());
+
+        const QString name = row.name;
+        const PortTable::Side side = ref.side;
+        port->pressed_changed.connect([this](const bool& pressed) {
+            m_liveRowPinned = pressed;
+            if (!pressed)
+                scheduleLiveRowRelease();
+        });
+        port->display_name_changed.connect([this, side, name](const std::string& t) {
+            m_portTable.setDisplayName(m_portTable.find(side, name), QString::fromStdString(t));
+            requestMeasure();
+            scheduleLiveRowRelease();
+        });
+
+        m_liveRow = ref;
+        m_liveRowPort = std::move(port);
+        m_liveRowPinned = false;
+    }
+
+    void NodeItemView::releaseLiveRow()
+    {
+        FrameScheduler::instance().cancel(&m_liveRow);
+        if (!m_liveRowPort)
+            return;
+
+        auto port = std::move(m_liveRowPort);
+        if (port->scene())
+            port->scene()->removeItem(port.get());
+        port->setParentItem(nullptr);
+
+        update(m_portTable.rowRect(m_liveRow));
+        m_liveRow = PortTable::RowRef();
+        m_liveRowPinned = false;
+    }
+
+    void NodeItemView::scheduleLiveRowRelease()
+    {
+        if (!m_liveRowPort)
+            return;
+
+        // Deferred: the stand-in may be inside its own event handler right now.
+        FrameScheduler::instance().post(&m_liveRow, [this]() {
+            if (m_liveRowPort && canReleaseLiveRow() && !m_liveRowPort->isUnderMouse())
+                releaseLiveRow();
+        });
+    }
+
+    bool NodeItemView::canReleaseLiveRow() const
+    {
+        return !m_liveRowPort || (!m_liveRowPinned && !m_liveRowPort->isEditing());
+    }
+
     // ----------------------
     // LAYOUT
     // ----------------------
     void NodeItemView::updateLayout()
     {
+        m_measureDirty = true;
+        flushLayout();
+    }
+
+    void NodeItemView::requestMeasure()
+    {
+        m_measureDirty = true;
+        scheduleLayout();
+    }
+
+    void NodeItemView::requestArrange()
+    {
+        m_arrangeDirty = true;
+        scheduleLayout();
+    }
+
+    void NodeItemView::scheduleLayout()
+    {
+        FrameScheduler::instance().post(this, [this]() { flushLayout(); });
+    }
+
+    void NodeItemView::flushLayout()
+    {
+        FrameScheduler::instance().cancel(this);
+        if (m_measureDirty)
+            measure();
+        if (m_arrangeDirty)
+            arrange();
+    }
+
+    void NodeItemView::measure()
+    {
+        prepareGeometryChange();
         updateRect();
 
         if (m_nodeNameLabel != nullptr)
@@ -283,33 +613,78 @@ namespace nodeeditor::core::view
             m_nodeNameLabel->set_pos((m_rect.width() - lbl.width()) / 2.0, (m_titleHeight - lbl.height()) / 2.0);
         }
 
+        m_inputOffsets.clear();
         qreal yInput = m_titleHeight + m_margin;
         for (const auto& port : std::as_const(m_inputs))
         {
-            port->set_pos(pos().x() + m_margin, pos().y() + yInput);
+            m_inputOffsets.append(QPointF(m_margin, yInput));
             yInput += port->boundingRect().height() + m_spacing;
         }
 
+        m_outputOffsets.clear();
         qreal yOutput = m_titleHeight + m_margin;
         for (const auto& port : std::as_const(m_outputs))
         {
-            port->set_pos(pos().x() + m_rect.width() - m_margin - port->boundingRect().width(), pos().y() + yOutput);
+            m_outputOffsets.append(QPointF(m_rect.width() - m_margin - port->boundingRect().width(), yOutput));
             yOutput += port->boundingRect().height() + m_spacing;
         }
 
+        // Painted rows continue each column below the item ports.
+        if (!m_portTable.isEmpty())
+        {
+            const qreal pitch = m_portTable.rowHeight() + m_spacing;
+            m_portTable.setGeometry(QPointF(m_margin, yInput), QPointF(m_rect.width() - m_margin, yOutput), pitch);
+            yInput += m_portTable.columnHeight(PortTable::Side::Input);
+            yOutput += m_portTable.columnHeight(PortTable::Side::Output);
+            if (m_liveRowPort && m_liveRow.isValid())
+                m_liveRowPort->setPos(m_portTable.rowRect(m_liveRow).topLeft());
+        }
+
+        // Ports and parameter widgets are children; offsets are node-local.
+        m_paramOffsets.clear();
         qreal paramX = m_margin + m_maxInputWidth + m_spacing;
         qreal yParam = m_titleHeight + m_margin;
         for (auto it = m_parameterPorts.constBegin(); it != m_parameterPorts.constEnd(); ++it)
         {
-            it.key()->set_pos(pos().x() + paramX, pos().y() + yParam);
-            it.value()->setPos(pos().x() + paramX, pos().y() + yParam + it.key()->boundingRect().height());
-            yParam += it.key()->boundingRect().height() + it.value()->boundingRect().height() + m_spacing;
+            const qreal portHeight = it.key()->boundingRect().height();
+            m_paramOffsets.append(QPointF(paramX, yParam));
+            qreal widgetHeight = 0;
+            QGraphicsItem* editor = it.value();
+            if (editor == nullptr)
+                editor = m_parameterControls.value(it.key(), nullptr);
+            if (editor != nullptr)
+            {
+                editor->setPos(paramX, yParam + portHeight);
+                widgetHeight = editor->boundingRect().height();
+            }
+            yParam += portHeight + widgetHeight + m_spacing;
         }
 
         qreal height = std::max({yInput, yOutput, yParam}) + m_margin;
-        m_rect = QRectF(0, 0, std::max(m_rect.width(), m_rect.width()), height);
-        prepareGeometryChange();
+        m_rect = QRectF(0, 0, m_rect.width(), height);
+
+        m_measureDirty = false;
+        m_arrangeDirty = true;
         update();
+
+        if (!m_portTable.isEmpty())
+            rows_changed.notify();
+    }
+
+    void NodeItemView::arrange()
+    {
+        for (int i = 0; i < m_inputs.size() && i < m_inputOffsets.size(); ++i)
+            m_inputs[i]->set_pos(m_inputOffsets[i].x(), m_inputOffsets[i].y());
+
+        for (int i = 0; i < m_outputs.size() && i < m_outputOffsets.size(); ++i)
+            m_outputs[i]->set_pos(m_outputOffsets[i].x(), m_outputOffsets[i].y());
+
+        int i = 0;
+        for (auto it = m_parameterPorts.constBegin(); it != m_parameterPorts.constEnd() && i < m_paramOffsets.size(); ++it, ++i)
+            it.key()->set_pos(m_paramOffsets[i].x(), m_paramOffsets[i].y());
+
+        m_arrangeDirty = false;
+        layout_changed.notify();
     }
 
     void NodeItemView::disconnectAllPorts()
@@ -320,6 +695,7 @@ namespace nodeeditor::core::view
                 // input->deleteLater();
             }
         m_inputs.clear();
+        m_inputIndex.clear();
 
         for (const auto& output : std::as_const(m_outputs))
             if (output)
@@ -327,15 +703,19 @@ namespace nodeeditor::core::view
                 // output->deleteLater();
             }
         m_outputs.clear();
+        m_outputIndex.clear();
 
         for (auto port : m_parameterPorts.keys())
         {
             auto* proxy = m_parameterPorts.value(port);
             port.reset();
-            proxy->deleteLater();
+            if (proxy != nullptr)
+                proxy->deleteLater();
         }
         m_parameterPorts.clear();
         m_parameterWidgets.clear();
+        qDeleteAll(m_parameterControls);
+        m_parameterControls.clear();
     }
 
     void NodeItemView::updateRect()
@@ -360,6 +740,16 @@ namespace nodeeditor::core::view
                 maxOutputHeight += (int)out->boundingRect().height() + m_spacing;
             }
 
+        if (!m_portTable.isEmpty())
+        {
+            const qreal pitch = m_portTable.rowHeight() + m_spacing;
+            maxInputWidth = std::fmax(maxInputWidth, m_portTable.maxWidth(PortTable::Side::Input));
+            maxOutputWidth = std::fmax(maxOutputWidth, m_portTable.maxWidth(PortTable::Side::Output));
+            // Virtualized columns only take their visible rows plus the anchor strips.
+            maxInputHeight += int(m_portTable.columnHeight(PortTable::Side::Input, pitch));
+            maxOutputHeight += int(m_portTable.columnHeight(PortTable::Side::Output, pitch));
+        }
+
         qreal maxParamWidth = 0;
         for (auto* proxy : m_parameterWidgets.values())
             if (proxy != nullptr)
@@ -367,6 +757,11 @@ namespace nodeeditor::core::view
                 maxParamWidth = std::fmax(maxParamWidth, proxy->boundingRect().width());
                 maxParamHeight += (int)proxy->boundingRect().height() + m_spacing;
             }
+        for (auto* control : m_parameterControls.values())
+        {
+            maxParamWidth = std::fmax(maxParamWidth, control->boundingRect().width());
+            maxParamHeight += (int)control->boundingRect().height() + m_spacing;
+        }
 
         qreal width = maxInputWidth + maxOutputWidth + 40 + maxParamWidth + 2 * m_margin + 2 * m_margin;
 
@@ -382,41 +777,130 @@ namespace nodeeditor::core::view
         return m_rect;
     }
 
-    void NodeItemView::paint(QPainter* painter, const QStyleOptionGraphicsItem*, QWidget*)
+    void NodeItemView::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget*)
     {
-        drawBackground(*painter);
-        drawTitle(*painter);
-        drawGlowingBounding(*painter);
+        const PaintDetail::Level detail = PaintDetail::current();
+        if (detail == PaintDetail::Bounds)
+        {
+            drawPlaceholder(*painter, bodyKey(1.0));
+            return;
+        }
+
+        paintBody(*painter);
+        if (detail != PaintDetail::Full)
+            return;
+
+        if (!m_portTable.isEmpty())
+            m_portTable.paint(*painter, option ? option->exposedRect : boundingRect(), m_liveRow);
     }
-    void NodeItemView::drawBackground(QPainter& painter) const
+
+    void NodeItemView::paintBody(QPainter& painter)
+    {
+        const NodeBodyKey key = bodyKey(painter);
+        if (key.pixelRatio > NodeRenderCache::MaxPixelRatio)
+        {
+            drawBody(painter, key);
+            return;
+        }
+
+        // Identical nodes (same size, colours and state) blit the same cached body.
+        auto& cache = NodeRenderCache::instance();
+        QPixmap body;
+        if (!cache.find(key, &body))
+        {
+            auto& rasterizer = NodeRasterizer::instance();
+            if (rasterizer.isEnabled())
+            {
+                rasterizer.request(key, [key](QPainter& p) { drawBody(p, key); }, this);
+                drawPlaceholder(painter, key);
+                return;
+            }
+            body = cache.pixmap(key, [&key](QPainter& p) { drawBody(p, key); });
+        }
+        painter.drawPixmap(QPointF(-NodeRenderCache::Padding, -NodeRenderCache::Padding), body);
+    }
+
+    void NodeItemView::prefetchBody(qreal pixelRatio) const
+    {
+        auto& rasterizer = NodeRasterizer::instance();
+        if (!rasterizer.isEnabled())
+            return;
+
+        const NodeBodyKey key = bodyKey(NodeRenderCache::quantizePixelRatio(pixelRatio));
+        if (key.pixelRatio > NodeRenderCache::MaxPixelRatio)
+            return;
+        rasterizer.request(key, [key](QPainter& p) { drawBody(p, key); });
+    }
+
+    NodeBodyKey NodeItemView::bodyKey(const QPainter& painter) const
+    {
+        const qreal dpr = painter.device() ? painter.device()->devicePixelRatioF() : 1.0;
+        const qreal lod = QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter.worldTransform());
+        return bodyKey(NodeRenderCache::quantizePixelRatio(dpr * lod));
+    }
+
+    NodeBodyKey NodeItemView::bodyKey(qreal pixelRatio) const
+    {
+        NodeBodyKey key;
+        key.width = m_rect.width();
+        key.height = m_rect.height();
+        key.titleHeight = m_titleHeight;
+        key.titleColor = m_nodeNameColor.rgba();
+        key.backgroundColor = m_bgColor.rgba();
+        key.borderColor = m_borderColor.rgba();
+        key.hovered = hovered_;
+        key.selected = select_;
+        key.pixelRatio = pixelRatio;
+        return key;
+    }
+
+    void NodeItemView::drawPlaceholder(QPainter& painter, const NodeBodyKey& key)
+    {
+        painter.setRenderHint(QPainter::Antialiasing, false);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(QColor::fromRgba(key.backgroundColor));
+        painter.drawRect(QRectF(0, key.titleHeight, key.width, key.height - key.titleHeight));
+        painter.setBrush(QColor::fromRgba(key.titleColor));
+        painter.drawRect(QRectF(0, 0, key.width, key.titleHeight));
+    }
+
+    void NodeItemView::drawBody(QPainter& painter, const NodeBodyKey& key)
+    {
+        drawBackground(painter, key);
+        drawTitle(painter, key);
+        drawGlowingBounding(painter, key);
+    }
+
+    void NodeItemView::drawBackground(QPainter& painter, const NodeBodyKey& key)
     {
         painter.setRenderHint(QPainter::Antialiasing, true);
-        painter.setPen(QPen(m_borderColor, 1));
-        painter.setBrush(m_bgColor);
-        painter.drawRoundedRect(m_rect, 10, 10);
+        painter.setPen(QPen(QColor::fromRgba(key.borderColor), 1));
+        painter.setBrush(QColor::fromRgba(key.backgroundColor));
+        painter.drawRoundedRect(QRectF(0, 0, key.width, key.height), 10, 10);
     }
 
-    void NodeItemView::drawTitle(QPainter& painter) const
+    void NodeItemView::drawTitle(QPainter& painter, const NodeBodyKey& key)
     {
-        QLinearGradient gradient(0, 0, m_rect.width(), 10);
-        gradient.setColorAt(0, m_nodeNameColor.lighter(150));
-        gradient.setColorAt(1, m_nodeNameColor.darker(120));
+        const QColor titleColor = QColor::fromRgba(key.titleColor);
+        QLinearGradient gradient(0, 0, key.width, 10);
+        gradient.setColorAt(0, titleColor.lighter(150));
+        gradient.setColorAt(1, titleColor.darker(120));
         painter.setPen(Qt::NoPen);
         painter.setBrush(gradient);
-        painter.drawRoundedRect(QRectF(0, 0, m_rect.width(), m_titleHeight), 10, 10);
+        painter.drawRoundedRect(QRectF(0, 0, key.width, key.titleHeight), 10, 10);
 
-        QRectF overlap(0, m_titleHeight - 5, m_rect.width(), 10);
-        painter.setBrush(m_bgColor);
+        QRectF overlap(0, key.titleHeight - 5, key.width, 10);
+        painter.setBrush(QColor::fromRgba(key.backgroundColor));
         painter.drawRect(overlap);
     }
 
-    void NodeItemView::drawGlowingBounding(QPainter& painter)
+    void NodeItemView::drawGlowingBounding(QPainter& painter, const NodeBodyKey& key)
     {
-        if (!hovered_ && !select_)
+        if (!key.hovered && !key.selected)
             return;
 
-        QRectF glowRect = m_rect.adjusted(-2, -2, 2, 2);
-        QColor glowColor = select_ ? QColor(0, 255, 100, 100) : QColor(0, 255, 255, 100);
+        QRectF glowRect = QRectF(0, 0, key.width, key.height).adjusted(-2, -2, 2, 2);
+        QColor glowColor = key.selected ? QColor(0, 255, 100, 100) : QColor(0, 255, 255, 100);
 
         QPen glowPen(glowColor);
         glowPen.setWidth(12);
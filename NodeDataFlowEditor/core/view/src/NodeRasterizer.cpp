@@ -0,0 +1,161 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/NodeRasterizer.hpp"
+
+#include <QGraphicsItem>
+#include <QMetaObject>
+#include <QRunnable>
+#include <QThread>
+#include <algorithm>
+
+namespace nodeeditor::core::view
+{
+    /**
+     * @brief Worker job painting one node body into an image.
+     */
+    class RasterJob : public QRunnable
+    {
+    public:
+        RasterJob(NodeRasterizer* owner, const NodeBodyKey& key, NodeRenderCache::Renderer render)
+            : m_owner(owner)
+            , m_key(key)
+            , m_render(std::move(render))
+        {
+            setAutoDelete(true);
+        }
+
+        void run() override
+        {
+            QImage image = NodeRenderCache::renderImage(m_key, m_render);
+            auto* owner = m_owner;
+            const NodeBodyKey key = m_key;
+            QMetaObject::invokeMethod(
+                owner, [owner, key, image]() { owner->deliver(key, image); }, Qt::QueuedConnection);
+        }
+
+    private:
+        NodeRasterizer* m_owner;
+        NodeBodyKey m_key;
+        NodeRenderCache::Renderer m_render;
+    };
+
+    NodeRasterizer::NodeRasterizer()
+    {
+        // Leave one core to the GUI thread.
+        m_pool.setMaxThreadCount(std::max(1, QThread::idealThreadCount() - 1));
+    }
+
+    NodeRasterizer&
+    NodeRasterizer::instance()
+    {
+        static NodeRasterizer rasterizer;
+        return rasterizer;
+    }
+
+    void
+    NodeRasterizer::setEnabled(bool enabled)
+    {
+        m_enabled = enabled;
+    }
+
+    bool
+    NodeRasterizer::isEnabled() const
+    {
+        return m_enabled;
+    }
+
+    void
+    NodeRasterizer::setMaxThreadCount(int count)
+    {
+        m_pool.setMaxThreadCount(std::max(1, count));
+    }
+
+    void
+    NodeRasterizer::request(const NodeBodyKey& key, const NodeRenderCache::Renderer& render, QGraphicsItem* waiter)
+    {
+        if (waiter)
+            ++m_stats.placeholders;
+
+        auto it = m_inFlight.find(key);
+        if (it != m_inFlight.end())
+        {
+            if (waiter && std::find(it->second.begin(), it->second.end(), waiter) == it->second.end())
+                it->second.push_back(waiter);
+            return;
+        }
+
+        if (NodeRenderCache::instance().contains(key))
+            return;
+
+        auto& waiters = m_inFlight[key];
+        if (waiter)
+            waiters.push_back(waiter);
+
+        ++m_stats.submitted;
+        m_pool.start(new RasterJob(this, key, render));
+    }
+
+    void
+    NodeRasterizer::forget(QGraphicsItem* waiter)
+    {
+        for (auto& [key, waiters] : m_inFlight)
+            waiters.erase(std::remove(waiters.begin(), waiters.end(), waiter), waiters.end());
+    }
+
+    NodeRasterizer::Stats
+    NodeRasterizer::stats() const
+    {
+        Stats s = m_stats;
+        s.pending = m_inFlight.size();
+        return s;
+    }
+
+    void
+    NodeRasterizer::resetStats()
+    {
+        m_stats = Stats();
+    }
+
+    void
+    NodeRasterizer::deliver(const NodeBodyKey& key, const QImage& image)
+    {
+        std::vector<QGraphicsItem*> waiters;
+        auto it = m_inFlight.find(key);
+        if (it != m_inFlight.end())
+        {
+            waiters = std::move(it->second);
+            m_inFlight.erase(it);
+        }
+
+        NodeRenderCache::instance().insert(key, QPixmap::fromImage(image));
+        ++m_stats.completed;
+
+        for (auto* item : waiters)
+            item->update();
+
+        body_ready.notify(key);
+    }
+
+} // namespace nodeeditor::core::view
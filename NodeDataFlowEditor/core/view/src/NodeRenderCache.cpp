@@ -0,0 +1,201 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/NodeRenderCache.hpp"
+
+#include <QPainter>
+#include <QtGlobal>
+#include <cmath>
+
+namespace nodeeditor::core::view
+{
+    std::size_t
+    NodeBodyKeyHash::operator()(const NodeBodyKey& k) const noexcept
+    {
+        std::size_t seed = 0;
+        auto mix = [&seed](std::size_t h) {
+            seed ^= h + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        };
+        mix(std::hash<qreal>()(k.width));
+        mix(std::hash<qreal>()(k.height));
+        mix(std::hash<qreal>()(k.titleHeight));
+        mix(k.titleColor);
+        mix(k.backgroundColor);
+        mix(k.borderColor);
+        mix((k.hovered ? 1u : 0u) | (k.selected ? 2u : 0u));
+        mix(std::hash<qreal>()(k.pixelRatio));
+        return seed;
+    }
+
+    NodeRenderCache&
+    NodeRenderCache::instance()
+    {
+        static NodeRenderCache cache;
+        return cache;
+    }
+
+    QPixmap
+    NodeRenderCache::pixmap(const NodeBodyKey& key, const Renderer& render)
+    {
+        QPixmap cached;
+        if (find(key, &cached))
+            return cached;
+
+        ++m_stats.misses;
+
+        const QSizeF logical(key.width + 2 * Padding, key.height + 2 * Padding);
+        QPixmap body(int(std::ceil(logical.width() * key.pixelRatio)), int(std::ceil(logical.height() * key.pixelRatio)));
+        body.setDevicePixelRatio(key.pixelRatio);
+        body.fill(Qt::transparent);
+        {
+            QPainter p(&body);
+            p.translate(Padding, Padding);
+            render(p);
+        }
+
+        insert(key, body);
+        return body;
+    }
+
+    bool
+    NodeRenderCache::find(const NodeBodyKey& key, QPixmap* out)
+    {
+        auto it = m_entries.find(key);
+        if (it == m_entries.end())
+            return false;
+
+        ++m_stats.hits;
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lru);
+        if (out)
+            *out = it->second.pixmap;
+        return true;
+    }
+
+    bool
+    NodeRenderCache::contains(const NodeBodyKey& key) const
+    {
+        return m_entries.find(key) != m_entries.end();
+    }
+
+    QImage
+    NodeRenderCache::renderImage(const NodeBodyKey& key, const Renderer& render)
+    {
+        const QSizeF logical(key.width + 2 * Padding, key.height + 2 * Padding);
+        QImage image(int(std::ceil(logical.width() * key.pixelRatio)),
+                     int(std::ceil(logical.height() * key.pixelRatio)),
+                     QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(key.pixelRatio);
+        image.fill(Qt::transparent);
+        {
+            QPainter p(&image);
+            p.translate(Padding, Padding);
+            render(p);
+        }
+        return image;
+    }
+
+    void
+    NodeRenderCache::insert(const NodeBodyKey& key, const QPixmap& pixmap)
+    {
+        auto it = m_entries.find(key);
+        if (it != m_entries.end())
+        {
+            m_stats.bytes -= it->second.bytes;
+            m_lru.erase(it->second.lru);
+            m_entries.erase(it);
+        }
+
+        Entry entry;
+        entry.pixmap = pixmap;
+        entry.bytes = qint64(pixmap.width()) * pixmap.height() * (pixmap.depth() / 8);
+        m_lru.push_front(key);
+        entry.lru = m_lru.begin();
+
+        m_stats.bytes += entry.bytes;
+        m_entries.emplace(key, std::move(entry));
+        evict();
+    }
+
+    qreal
+    NodeRenderCache::quantizePixelRatio(qreal ratio)
+    {
+        if (ratio <= 0.0)
+            return 1.0;
+        return std::pow(2.0, std::ceil(std::log2(ratio) * 2.0) / 2.0);
+    }
+
+    void
+    NodeRenderCache::setMemoryBudget(qint64 bytes)
+    {
+        m_budget = qMax<qint64>(0, bytes);
+        evict();
+    }
+
+    qint64
+    NodeRenderCache::memoryBudget() const
+    {
+        return m_budget;
+    }
+
+    void
+    NodeRenderCache::clear()
+    {
+        m_entries.clear();
+        m_lru.clear();
+        m_stats.bytes = 0;
+    }
+
+    NodeRenderCache::Stats
+    NodeRenderCache::stats() const
+    {
+        Stats s = m_stats;
+        s.entries = m_entries.size();
+        return s;
+    }
+
+    void
+    NodeRenderCache::resetStats()
+    {
+        m_stats.hits = 0;
+        m_stats.misses = 0;
+        m_stats.evictions = 0;
+    }
+
+    void
+    NodeRenderCache::evict()
+    {
+        // Always keep the most recent entry, even if it alone exceeds the budget.
+        while (m_stats.bytes > m_budget && m_lru.size() > 1)
+        {
+            auto it = m_entries.find(m_lru.back());
+            m_lru.pop_back();
+            if (it == m_entries.end())
+                continue;
+            m_stats.bytes -= it->second.bytes;
+            m_entries.erase(it);
+            ++m_stats.evictions;
+        }
+    }
+
+} // namespace nodeeditor::core::view
@@ -0,0 +1,406 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/ParameterControl.hpp"
+
+#include <QDoubleSpinBox>
+#include <QFontMetricsF>
+#include <QGraphicsProxyWidget>
+#include <QGraphicsSceneMouseEvent>
+#include <QLineEdit>
+#include <QPainter>
+#include <QSpinBox>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace nodeeditor::core::view
+{
+    namespace
+    {
+        const QColor kFrameColor(45, 45, 45);
+        const QColor kBorderColor(70, 70, 70);
+        const QColor kTextColor(220, 220, 220);
+        const QColor kAccentColor(80, 140, 220);
+    } // namespace
+
+    // ----------------------
+    // ParameterControl
+    // ----------------------
+    ParameterControl::ParameterControl(const QVariant& value, QGraphicsItem* parent)
+        : QGraphicsItem(parent)
+        , m_value(value)
+    {
+        setAcceptedMouseButtons(Qt::LeftButton);
+    }
+
+    ParameterControl::~ParameterControl() = default;
+
+    QRectF
+    ParameterControl::boundingRect() const
+    {
+        return QRectF(QPointF(), m_size);
+    }
+
+    void
+    ParameterControl::paint(QPainter* painter, const QStyleOptionGraphicsItem*, QWidget*)
+    {
+        if (!painter || m_editorProxy)
+            return;
+
+        const QRectF rect = boundingRect().adjusted(0.5, 0.5, -0.5, -0.5);
+        painter->setRenderHint(QPainter::Antialiasing, true);
+        painter->setPen(kBorderColor);
+        painter->setBrush(kFrameColor);
+        painter->drawRoundedRect(rect, 3, 3);
+
+        painter->save();
+        paintValue(*painter, rect.adjusted(4, 0, -4, 0));
+        painter->restore();
+    }
+
+    void
+    ParameterControl::setSize(const QSizeF& size)
+    {
+        if (m_size == size)
+            return;
+        prepareGeometryChange();
+        m_size = size;
+        if (m_editorProxy)
+            m_editorProxy->resize(size);
+    }
+
+    QSizeF
+    ParameterControl::size() const
+    {
+        return m_size;
+    }
+
+    std::uint32_t
+    ParameterControl::typeId() const
+    {
+        return m_typeId;
+    }
+
+    void
+    ParameterControl::setTypeId(std::uint32_t id)
+    {
+        m_typeId = id;
+    }
+
+    const QVariant&
+    ParameterControl::value() const
+    {
+        return m_value;
+    }
+
+    void
+    ParameterControl::setValue(const QVariant& value)
+    {
+        if (m_value == value)
+            return;
+        m_value = value;
+        update();
+        value_changed.notify(m_value);
+    }
+
+    void
+    ParameterControl::beginEdit()
+    {
+        if (m_editorProxy)
+            return;
+
+        m_editor = createEditor();
+        if (!m_editor)
+            return;
+
+        m_editorProxy = new QGraphicsProxyWidget(this);
+        m_editorProxy->setWidget(m_editor);
+        m_editorProxy->setGeometry(boundingRect());
+        m_editor->setFocus();
+        update();
+    }
+
+    void
+    ParameterControl::endEdit()
+    {
+        if (!m_editorProxy)
+            return;
+
+        // Detach first: the editor's finish signal can fire again on focus loss.
+        QGraphicsProxyWidget* proxy = m_editorProxy;
+        const QVariant edited = editorValue(m_editor);
+        m_editorProxy = nullptr;
+        m_editor = nullptr;
+
+        proxy->setVisible(false);
+        proxy->deleteLater();
+
+        setValue(edited);
+        update();
+    }
+
+    bool
+    ParameterControl::isEditing() const
+    {
+        return m_editorProxy != nullptr;
+    }
+
+    QWidget*
+    ParameterControl::createEditor()
+    {
+        return nullptr;
+    }
+
+    QVariant
+    ParameterControl::editorValue(QWidget*) const
+    {
+        return m_value;
+    }
+
+    void
+    ParameterControl::mouseDoubleClickEvent(QGraphicsSceneMouseEvent* event)
+    {
+        beginEdit();
+        event->accept();
+    }
+
+    // ----------------------
+    // ToggleParameterControl
+    // ----------------------
+    ToggleParameterControl::ToggleParameterControl(bool checked, QGraphicsItem* parent)
+        : ParameterControl(checked, parent)
+    {
+    }
+
+    ParameterControl*
+    ToggleParameterControl::clone() const
+    {
+        auto* copy = new ToggleParameterControl(m_value.toBool());
+        copy->setSize(size());
+        return copy;
+    }
+
+    void
+    ToggleParameterControl::paintValue(QPainter& painter, const QRectF& rect) const
+    {
+        const qreal side = std::min<qreal>(14.0, rect.height() - 6);
+        const QRectF box(rect.left(), rect.center().y() - side / 2.0, side, side);
+
+        painter.setPen(kBorderColor);
+        painter.setBrush(m_value.toBool() ? kAccentColor : kFrameColor.darker(130));
+        painter.drawRoundedRect(box, 2, 2);
+
+        if (m_value.toBool())
+        {
+            painter.setPen(QPen(Qt::white, 2));
+            painter.drawPolyline(QPolygonF() << QPointF(box.left() + side * 0.2, box.center().y())
+                                             << QPointF(box.left() + side * 0.42, box.bottom() - side * 0.25)
+                                             << QPointF(box.right() - side * 0.2, box.top() + side * 0.25));
+        }
+    }
+
+    void
+    ToggleParameterControl::mousePressEvent(QGraphicsSceneMouseEvent* event)
+    {
+        setValue(!m_value.toBool());
+        event->accept();
+    }
+
+    void
+    ToggleParameterControl::mouseDoubleClickEvent(QGraphicsSceneMouseEvent* event)
+    {
+        // A double-click is just a second toggle.
+        mousePressEvent(event);
+    }
+
+    // ----------------------
+    // NumberParameterControl
+    // ----------------------
+    NumberParameterControl::NumberParameterControl(bool integer, QGraphicsItem* parent)
+        : ParameterControl(integer ? QVariant(0) : QVariant(0.0), parent)
+        , m_integer(integer)
+        , m_minimum(integer ? double(std::numeric_limits<int>::min()) : -std::numeric_limits<double>::max())
+        , m_maximum(integer ? double(std::numeric_limits<int>::max()) : std::numeric_limits<double>::max())
+        , m_step(integer ? 1.0 : 0.1)
+    {
+        setCursor(Qt::SizeHorCursor);
+    }
+
+    ParameterControl*
+    NumberParameterControl::clone() const
+    {
+        auto* copy = new NumberParameterControl(m_integer);
+        copy->m_minimum = m_minimum;
+        copy->m_maximum = m_maximum;
+        copy->m_step = m_step;
+        copy->m_value = m_value;
+        copy->setSize(size());
+        return copy;
+    }
+
+    void
+    NumberParameterControl::setRange(double minimum, double maximum)
+    {
+        m_minimum = std::min(minimum, maximum);
+        m_maximum = std::max(minimum, maximum);
+        const double v = clamp(m_value.toDouble());
+        setValue(m_integer ? QVariant(int(v)) : QVariant(v));
+    }
+
+    void
+    NumberParameterControl::setStep(double step)
+    {
+        m_step = step;
+    }
+
+    bool
+    NumberParameterControl::isInteger() const
+    {
+        return m_integer;
+    }
+
+    double
+    NumberParameterControl::clamp(double v) const
+    {
+        return std::clamp(v, m_minimum, m_maximum);
+    }
+
+    QWidget*
+    NumberParameterControl::createEditor()
+    {
+        if (m_integer)
+        {
+            auto* spin = new QSpinBox();
+            spin->setRange(int(m_minimum), int(m_maximum));
+            spin->setValue(m_value.toInt());
+            QObject::connect(spin, &QSpinBox::editingFinished, [this]() { endEdit(); });
+            return spin;
+        }
+
+        auto* spin = new QDoubleSpinBox();
+        spin->setRange(m_minimum, m_maximum);
+        spin->setSingleStep(m_step);
+        spin->setValue(m_value.toDouble());
+        QObject::connect(spin, &QDoubleSpinBox::editingFinished, [this]() { endEdit(); });
+        return spin;
+    }
+
+    QVariant
+    NumberParameterControl::editorValue(QWidget* editor) const
+    {
+        if (auto* spin = qobject_cast<QSpinBox*>(editor))
+            return spin->value();
+        if (auto* spin = qobject_cast<QDoubleSpinBox*>(editor))
+            return spin->value();
+        return m_value;
+    }
+
+    void
+    NumberParameterControl::paintValue(QPainter& painter, const QRectF& rect) const
+    {
+        painter.setPen(kTextColor);
+        const QString text = m_integer ? QString::number(m_value.toInt()) : QString::number(m_value.toDouble(), 'g', 6);
+        painter.drawText(rect, Qt::AlignCenter, text);
+
+        // Drag affordance on both ends.
+        painter.setPen(kBorderColor.lighter(150));
+        painter.drawText(rect, Qt::AlignVCenter | Qt::AlignLeft, QStringLiteral("<"));
+        painter.drawText(rect, Qt::AlignVCenter | Qt::AlignRight, QStringLiteral(">"));
+    }
+
+    void
+    NumberParameterControl::mousePressEvent(QGraphicsSceneMouseEvent* event)
+    {
+        m_dragStartX = event->scenePos().x();
+        m_dragStartValue = m_value.toDouble();
+        event->accept();
+    }
+
+    void
+    NumberParameterControl::mouseMoveEvent(QGraphicsSceneMouseEvent* event)
+    {
+        const qreal pixels = event->scenePos().x() - m_dragStartX;
+        const double step = event->modifiers().testFlag(Qt::ShiftModifier) ? m_step / 10.0 : m_step;
+        const double v = clamp(m_dragStartValue + pixels * step);
+        setValue(m_integer ? QVariant(int(std::lround(v))) : QVariant(v));
+        event->accept();
+    }
+
+    void
+    NumberParameterControl::mouseReleaseEvent(QGraphicsSceneMouseEvent* event)
+    {
+        event->accept();
+    }
+
+    // ----------------------
+    // TextParameterControl
+    // ----------------------
+    TextParameterControl::TextParameterControl(const QString& text, QGraphicsItem* parent)
+        : ParameterControl(text, parent)
+    {
+        setCursor(Qt::IBeamCursor);
+    }
+
+    ParameterControl*
+    TextParameterControl::clone() const
+    {
+        auto* copy = new TextParameterControl(m_value.toString());
+        copy->setSize(size());
+        return copy;
+    }
+
+    QWidget*
+    TextParameterControl::createEditor()
+    {
+        auto* edit = new QLineEdit(m_value.toString());
+        edit->selectAll();
+        QObject::connect(edit, &QLineEdit::editingFinished, [this]() { endEdit(); });
+        return edit;
+    }
+
+    QVariant
+    TextParameterControl::editorValue(QWidget* editor) const
+    {
+        if (auto* edit = qobject_cast<QLineEdit*>(editor))
+            return edit->text();
+        return m_value;
+    }
+
+    void
+    TextParameterControl::paintValue(QPainter& painter, const QRectF& rect) const
+    {
+        painter.setPen(kTextColor);
+        const QFontMetricsF metrics(painter.font());
+        painter.drawText(rect, Qt::AlignVCenter | Qt::AlignLeft, metrics.elidedText(m_value.toString(), Qt::ElideRight, rect.width()));
+    }
+
+    void
+    TextParameterControl::mousePressEvent(QGraphicsSceneMouseEvent* event)
+    {
+        beginEdit();
+        event->accept();
+    }
+
+} // namespace nodeeditor::core::view
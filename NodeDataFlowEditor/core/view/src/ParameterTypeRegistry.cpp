@@ -0,0 +1,160 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/ParameterTypeRegistry.hpp"
+#include "core/view/ParameterControl.hpp"
+
+namespace nodeeditor::core::view
+{
+    ParameterTypeRegistry::TypeId
+    ParameterTypeRegistry::intern(const std::string& name)
+    {
+        auto it = nameToId.find(name);
+        if (it != nameToId.end())
+            return it->second;
+
+        const auto id = static_cast<TypeId>(entries.size());
+        entries.emplace_back();
+        nameToId.emplace(name, id);
+        return id;
+    }
+
+    ParameterTypeRegistry::TypeId
+    ParameterTypeRegistry::typeId(const std::string& name)
+    {
+        ensureBuiltins();
+        auto it = nameToId.find(name);
+        return it != nameToId.end() ? it->second : InvalidType;
+    }
+
+    ParameterTypeRegistry::TypeId
+    ParameterTypeRegistry::registerType(const std::string& name, Factories factories)
+    {
+        // Seed the built-ins first so they can never overwrite this registration later.
+        ensureBuiltins();
+        const TypeId id = intern(name);
+        Entry& e = entries[id];
+        // A prototype wins over factories in createControl(); replacing a type drops it.
+        e.prototype.reset();
+        e.factories = std::move(factories);
+        e.registered = true;
+        return id;
+    }
+
+    ParameterTypeRegistry::TypeId
+    ParameterTypeRegistry::registerAlias(const std::string& alias, const std::string& name)
+    {
+        const TypeId id = intern(name);
+        nameToId[alias] = id;
+        return id;
+    }
+
+    void
+    ParameterTypeRegistry::setPrototype(TypeId id, std::unique_ptr<ParameterControl> prototype)
+    {
+        if (Entry* e = entry(id))
+        {
+            e->prototype = std::move(prototype);
+            e->registered = true;
+        }
+    }
+
+    bool
+    ParameterTypeRegistry::isRegistered(TypeId id)
+    {
+        ensureBuiltins();
+        const Entry* e = entry(id);
+        return e && e->registered;
+    }
+
+    QVariant
+    ParameterTypeRegistry::createStorage(TypeId id)
+    {
+        ensureBuiltins();
+        const Entry* e = entry(id);
+        if (!e)
+            return QVariant();
+        if (e->factories.makeStorage)
+            return e->factories.makeStorage();
+        return e->prototype ? e->prototype->value() : QVariant();
+    }
+
+    ParameterControl*
+    ParameterTypeRegistry::createControl(TypeId id)
+    {
+        ensureBuiltins();
+        const Entry* e = entry(id);
+        if (!e)
+            return nullptr;
+        ParameterControl* control = nullptr;
+        if (e->prototype)
+            control = e->prototype->clone();
+        else if (e->factories.makeControl)
+        {
+            control = e->factories.makeControl();
+            if (control && e->factories.makeStorage)
+                control->setValue(e->factories.makeStorage());
+        }
+        if (control)
+            control->setTypeId(id);
+        return control;
+    }
+
+    QWidget*
+    ParameterTypeRegistry::createEditor(TypeId id)
+    {
+        ensureBuiltins();
+        const Entry* e = entry(id);
+        return e && e->factories.makeEditor ? e->factories.makeEditor() : nullptr;
+    }
+
+    ParameterTypeRegistry::Entry*
+    ParameterTypeRegistry::entry(TypeId id)
+    {
+        if (id == InvalidType || id >= entries.size())
+            return nullptr;
+        return &entries[id];
+    }
+
+    void
+    ParameterTypeRegistry::ensureBuiltins()
+    {
+        static const bool registered = [] {
+            // Built-ins are prototypes: creating one is a clone, not a factory call chain.
+            const TypeId text = intern("QString");
+            registerAlias("string", "QString");
+            setPrototype(text, std::make_unique<TextParameterControl>());
+
+            setPrototype(intern("bool"), std::make_unique<ToggleParameterControl>());
+            setPrototype(intern("int"), std::make_unique<NumberParameterControl>(true));
+
+            const TypeId real = intern("double");
+            registerAlias("float", "double");
+            setPrototype(real, std::make_unique<NumberParameterControl>(false));
+            return true;
+        }();
+        (void)registered;
+    }
+
+} // namespace nodeeditor::core::view
@@ -24,6 +24,7 @@
 
 #include "core/view/PortItemView.hpp"
 #include "core/view/EditableArrowItemView.hpp"
+#include "core/view/PaintDetail.hpp"
 
 #include <QGraphicsSceneMouseEvent>
 #include <QPainter>
@@ -44,6 +45,7 @@ namespace nodeeditor::core::view
         m_editableArrow = new EditableArrowItemView(m_portDisplayName, this);
         m_editableArrow->setArrowBeforeLabel(isAnyInputPort());
         m_editableArrow->setEditable(true);
+        m_editableArrow->setLabelDroppable(true);
         m_editableArrow->setColor(m_portColor);
 
         m_editableArrow->setOnTextChanged([this](const QString& newText) {
@@ -68,6 +70,43 @@ namespace nodeeditor::core::view
 
     PortItemView::~PortItemView() = default;
 
+    void
+    PortItemView::recycle()
+    {
+        if (m_editableArrow && m_editableArrow->isEditing())
+            m_editableArrow->finishEditing();
+
+        resetViewConnections();
+        name_changed.disconnectAll();
+        module_name_changed.disconnectAll();
+        display_name_changed.disconnectAll();
+        orientation_changed.disconnectAll();
+        onNameChanged = nullptr;
+        // Not clearTags(): that also wipes the global TagRegistry.
+        setTagBitMask(common::taggable::TagBitMask());
+    }
+
+    void
+    PortItemView::resetForReuse(QString name,
+                                QString displayName,
+                                QString moduleName,
+                                common::utility::SPort::Orientation orientation,
+                                QGraphicsItem* parent)
+    {
+        setParentItem(parent);
+        setPos(0, 0);
+        setVisible(true);
+        setOpacity(1.0);
+        setColor(QColor(110, 110, 110));
+
+        setName(name);
+        setDisplayName(displayName);
+        setOrientation(orientation);
+        setModuleName(moduleName);
+
+        repositionLabel();
+    }
+
     QRectF
     PortItemView::boundingRect() const
     {
@@ -86,6 +125,9 @@ namespace nodeeditor::core::view
     void
     PortItemView::paint(QPainter* painter, const QStyleOptionGraphicsItem*, QWidget*)
     {
+        if (PaintDetail::current() != PaintDetail::Full)
+            return;
+
         painter->setRenderHint(QPainter::Antialiasing);
 
         QRectF rect = boundingRect();
@@ -237,6 +279,12 @@ namespace nodeeditor::core::view
         return m_moduleName;
     }
 
+    bool
+    PortItemView::isEditing() const
+    {
+        return m_editableArrow && m_editableArrow->isEditing();
+    }
+
     void
     PortItemView::setColor(const QColor& color)
     {
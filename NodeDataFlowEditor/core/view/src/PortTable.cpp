@@ -0,0 +1,459 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/PortTable.hpp"
+#include "core/view/EditableArrowItemView.hpp"
+#include "core/view/RenderQuality.hpp"
+
+#include <QPainter>
+#include <algorithm>
+#include <cmath>
+
+namespace nodeeditor::core::view
+{
+    int
+    PortTable::append(Side side, const QString& name, const QString& displayName, const QColor& color)
+    {
+        Row r;
+        r.name = name;
+        r.displayName = displayName.isEmpty() ? name : displayName;
+        r.layout = TextLayoutCache::instance().layout(r.displayName, EditableArrowItemView::labelFont());
+        r.color = color.rgba();
+
+        m_rowHeight = std::max(m_rowHeight, r.layout.size.height());
+        qreal& maxWidth = side == Side::Input ? m_maxInputWidth : m_maxOutputWidth;
+        maxWidth = std::max(maxWidth, rowWidth(r));
+
+        auto& list = rows(side);
+        list.append(r);
+        const int index = list.size() - 1;
+        (side == Side::Input ? m_inputIndex : m_outputIndex).insert(name, index);
+        return index;
+    }
+
+    bool
+    PortTable::remove(Side side, const QString& name)
+    {
+        const RowRef ref = find(side, name);
+        if (!ref.isValid())
+            return false;
+
+        rows(side).remove(ref.index);
+        (side == Side::Input ? m_inputIndex : m_outputIndex).remove(name);
+        reindex(side, ref.index);
+        refreshMaxWidth(side);
+        setScrollOffset(m_scrollOffset);
+        return true;
+    }
+
+    void
+    PortTable::clear()
+    {
+        m_inputs.clear();
+        m_outputs.clear();
+        m_inputIndex.clear();
+        m_outputIndex.clear();
+        m_linkedInputs.clear();
+        m_linkedOutputs.clear();
+        m_rowHeight = 0.;
+        m_maxInputWidth = 0.;
+        m_maxOutputWidth = 0.;
+        m_scrollOffset = 0;
+    }
+
+    PortTable::RowRef
+    PortTable::find(Side side, const QString& name) const
+    {
+        const auto& index = side == Side::Input ? m_inputIndex : m_outputIndex;
+        auto it = index.constFind(name);
+        return it == index.constEnd() ? RowRef() : RowRef{side, it.value()};
+    }
+
+    const PortTable::Row&
+    PortTable::row(const RowRef& ref) const
+    {
+        return rows(ref.side)[ref.index];
+    }
+
+    void
+    PortTable::setDisplayName(const RowRef& ref, const QString& displayName)
+    {
+        if (!ref.isValid() || ref.index >= count(ref.side))
+            return;
+
+        Row& r = rows(ref.side)[ref.index];
+        if (r.displayName == displayName)
+            return;
+
+        r.displayName = displayName;
+        r.layout = TextLayoutCache::instance().layout(displayName, EditableArrowItemView::labelFont());
+        refreshMaxWidth(ref.side);
+    }
+
+    void
+    PortTable::setTags(const RowRef& ref, const common::taggable::TagBitMask& tags)
+    {
+        if (!ref.isValid() || ref.index >= count(ref.side))
+            return;
+        rows(ref.side)[ref.index].tags = tags;
+    }
+
+    void
+    PortTable::addLinks(const RowRef& ref, int delta)
+    {
+        if (!ref.isValid() || ref.index >= count(ref.side))
+            return;
+
+        Row& r = rows(ref.side)[ref.index];
+        r.links = std::max(0, r.links + delta);
+
+        auto& linked = ref.side == Side::Input ? m_linkedInputs : m_linkedOutputs;
+        if (r.links > 0)
+            linked.insert(ref.index);
+        else
+            linked.remove(ref.index);
+    }
+
+    int
+    PortTable::count(Side side) const
+    {
+        return rows(side).size();
+    }
+
+    bool
+    PortTable::isEmpty() const
+    {
+        return m_inputs.isEmpty() && m_outputs.isEmpty();
+    }
+
+    qreal
+    PortTable::rowHeight() const
+    {
+        return m_rowHeight;
+    }
+
+    qreal
+    PortTable::maxWidth(Side side) const
+    {
+        return side == Side::Input ? m_maxInputWidth : m_maxOutputWidth;
+    }
+
+    // ----------------------
+    // VIRTUALIZATION
+    // ----------------------
+    void
+    PortTable::setMaxVisibleRows(int rows)
+    {
+        m_maxVisibleRows = std::max(0, rows);
+        setScrollOffset(m_scrollOffset);
+    }
+
+    int
+    PortTable::maxVisibleRows() const
+    {
+        return m_maxVisibleRows;
+    }
+
+    void
+    PortTable::setScrollOffset(int firstRow)
+    {
+        m_scrollOffset = std::clamp(firstRow, 0, maxScrollOffset());
+    }
+
+    int
+    PortTable::scrollOffset() const
+    {
+        return m_scrollOffset;
+    }
+
+    int
+    PortTable::maxScrollOffset() const
+    {
+        if (m_maxVisibleRows == 0)
+            return 0;
+        return std::max(0, std::max(count(Side::Input), count(Side::Output)) - m_maxVisibleRows);
+    }
+
+    bool
+    PortTable::isVirtualized(Side side) const
+    {
+        return m_maxVisibleRows > 0 && count(side) > m_maxVisibleRows;
+    }
+
+    bool
+    PortTable::isRowVisible(const RowRef& ref) const
+    {
+        const int first = firstVisible(ref.side);
+        return ref.isValid() && ref.index >= first && ref.index < first + visibleCount(ref.side);
+    }
+
+    int
+    PortTable::firstVisible(Side side) const
+    {
+        if (!isVirtualized(side))
+            return 0;
+        return std::min(m_scrollOffset, count(side) - m_maxVisibleRows);
+    }
+
+    int
+    PortTable::visibleCount(Side side) const
+    {
+        return isVirtualized(side) ? m_maxVisibleRows : count(side);
+    }
+
+    // ----------------------
+    // GEOMETRY
+    // ----------------------
+    void
+    PortTable::setGeometry(const QPointF& inputTopLeft, const QPointF& outputTopRight, qreal pitch)
+    {
+        m_inputTopLeft = inputTopLeft;
+        m_outputTopRight = outputTopRight;
+        m_pitch = pitch;
+    }
+
+    qreal
+    PortTable::columnHeight(Side side) const
+    {
+        return columnHeight(side, m_pitch);
+    }
+
+    qreal
+    PortTable::columnHeight(Side side, qreal pitch) const
+    {
+        const qreal rowsHeight = visibleCount(side) * pitch;
+        return isVirtualized(side) ? rowsHeight + 2 * AnchorStripHeight : rowsHeight;
+    }
+
+    qreal
+    PortTable::columnTop(Side side) const
+    {
+        const qreal top = side == Side::Input ? m_inputTopLeft.y() : m_outputTopRight.y();
+        return isVirtualized(side) ? top + AnchorStripHeight : top;
+    }
+
+    qreal
+    PortTable::columnX(Side side, qreal width) const
+    {
+        return side == Side::Input ? m_inputTopLeft.x() : m_outputTopRight.x() - width;
+    }
+
+    QRectF
+    PortTable::anchorStrip(Side side, bool below) const
+    {
+        const qreal width = maxWidth(side);
+        const qreal y = below ? columnTop(side) + visibleCount(side) * m_pitch
+                              : columnTop(side) - AnchorStripHeight;
+        return QRectF(columnX(side, width), y, width, AnchorStripHeight);
+    }
+
+    QRectF
+    PortTable::rowRect(const RowRef& ref) const
+    {
+        if (!ref.isValid() || ref.index >= count(ref.side))
+            return QRectF();
+
+        const int first = firstVisible(ref.side);
+        if (ref.index < first)
+            return anchorStrip(ref.side, false);
+        if (ref.index >= first + visibleCount(ref.side))
+            return anchorStrip(ref.side, true);
+
+        const qreal width = rowWidth(row(ref));
+        return QRectF(columnX(ref.side, width), columnTop(ref.side) + (ref.index - first) * m_pitch, width, m_rowHeight);
+    }
+
+    PortTable::RowRef
+    PortTable::hitTest(const QPointF& localPos) const
+    {
+        if (m_pitch <= 0.)
+            return RowRef();
+
+        for (Side side : {Side::Input, Side::Output})
+        {
+            const qreal offset = localPos.y() - columnTop(side);
+            if (offset < 0.)
+                continue;
+
+            const int slot = int(offset / m_pitch);
+            if (slot >= visibleCount(side) || offset - slot * m_pitch > m_rowHeight)
+                continue;
+
+            const RowRef ref{side, firstVisible(side) + slot};
+            const QRectF rect = rowRect(ref);
+            if (localPos.x() >= rect.left() && localPos.x() <= rect.right())
+                return ref;
+        }
+        return RowRef();
+    }
+
+    // ----------------------
+    // PAINT
+    // ----------------------
+    void
+    PortTable::paint(QPainter& painter, const QRectF& exposed, const RowRef& skip) const
+    {
+        if (isEmpty() || m_pitch <= 0.)
+            return;
+
+        painter.save();
+        painter.setFont(EditableArrowItemView::labelFont());
+        paintColumn(painter, exposed, Side::Input, skip);
+        paintColumn(painter, exposed, Side::Output, skip);
+        painter.restore();
+    }
+
+    void
+    PortTable::paintColumn(QPainter& painter, const QRectF& exposed, Side side, const RowRef& skip) const
+    {
+        const auto& list = rows(side);
+        if (list.isEmpty())
+            return;
+
+        // Only the visible rows overlapping the exposed band are visited.
+        const int first = firstVisible(side);
+        const int end = first + visibleCount(side);
+        const qreal top = columnTop(side);
+        const int from = std::max(first, first + int(std::floor((exposed.top() - top) / m_pitch)));
+        const int to = std::min(end - 1, first + int(std::ceil((exposed.bottom() - top) / m_pitch)));
+
+        const bool labels = RenderQuality::instance().portLabels();
+        const bool arrowBefore = side == Side::Input;
+        const QPointF labelPos = arrowBefore ? QPointF(EditableArrowItemView::ArrowWidth + EditableArrowItemView::ArrowSpacing, 0) : QPointF();
+        for (int i = from; i <= to; ++i)
+        {
+            const RowRef ref{side, i};
+            if (ref == skip)
+                continue;
+
+            const Row& r = list[i];
+            const QPointF origin = rowRect(ref).topLeft();
+
+            if (labels)
+            {
+                painter.setPen(Qt::white);
+                TextLayoutCache::draw(painter, origin + labelPos, r.layout);
+            }
+
+            painter.setRenderHint(QPainter::Antialiasing, true);
+            painter.setPen(Qt::NoPen);
+            painter.setBrush(QColor::fromRgba(r.color));
+            painter.drawPolygon(EditableArrowItemView::arrowPolygon(arrowBefore, r.layout.size.width(), r.layout.size.height())
+                                    .translated(origin));
+        }
+
+        if (!isVirtualized(side))
+            return;
+
+        int linksAbove = 0;
+        int linksBelow = 0;
+        for (int index : side == Side::Input ? m_linkedInputs : m_linkedOutputs)
+        {
+            if (index < first)
+                ++linksAbove;
+            else if (index >= end)
+                ++linksBelow;
+        }
+
+        const QRectF above = anchorStrip(side, false);
+        if (above.intersects(exposed))
+            paintAnchorStrip(painter, side, above, first, linksAbove);
+        const QRectF below = anchorStrip(side, true);
+        if (below.intersects(exposed))
+            paintAnchorStrip(painter, side, below, count(side) - end, linksBelow);
+    }
+
+    void
+    PortTable::paintAnchorStrip(QPainter& painter, Side side, const QRectF& strip, int hidden, int hiddenLinks) const
+    {
+        if (hidden <= 0)
+            return;
+
+        painter.setRenderHint(QPainter::Antialiasing, false);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(QColor(255, 255, 255, 20));
+        painter.drawRect(strip);
+
+        painter.setPen(QColor(160, 160, 160));
+        painter.drawText(strip, Qt::AlignCenter, QStringLiteral("%1 more").arg(hidden));
+
+        // Edges of hidden rows converge on this dot.
+        if (hiddenLinks > 0)
+        {
+            const qreal radius = 3.0;
+            const qreal x = side == Side::Input ? strip.left() + radius : strip.right() - radius;
+            painter.setRenderHint(QPainter::Antialiasing, true);
+            painter.setPen(Qt::NoPen);
+            painter.setBrush(QColor(230, 180, 60));
+            painter.drawEllipse(QPointF(x, strip.center().y()), radius, radius);
+        }
+    }
+
+    // ----------------------
+    // HELPERS
+    // ----------------------
+    QVector<PortTable::Row>&
+    PortTable::rows(Side side)
+    {
+        return side == Side::Input ? m_inputs : m_outputs;
+    }
+
+    const QVector<PortTable::Row>&
+    PortTable::rows(Side side) const
+    {
+        return side == Side::Input ? m_inputs : m_outputs;
+    }
+
+    qreal
+    PortTable::rowWidth(const Row& row) const
+    {
+        return EditableArrowItemView::ArrowWidth + EditableArrowItemView::ArrowSpacing + row.layout.size.width();
+    }
+
+    void
+    PortTable::refreshMaxWidth(Side side)
+    {
+        qreal maxWidth = 0.;
+        for (const auto& r : rows(side))
+            maxWidth = std::max(maxWidth, rowWidth(r));
+        (side == Side::Input ? m_maxInputWidth : m_maxOutputWidth) = maxWidth;
+    }
+
+    void
+    PortTable::reindex(Side side, int from)
+    {
+        const auto& list = rows(side);
+        auto& index = side == Side::Input ? m_inputIndex : m_outputIndex;
+        auto& linked = side == Side::Input ? m_linkedInputs : m_linkedOutputs;
+
+        for (int i = from; i < list.size(); ++i)
+            index[list[i].name] = i;
+
+        linked.clear();
+        for (int i = 0; i < list.size(); ++i)
+            if (list[i].links > 0)
+                linked.insert(i);
+    }
+
+} // namespace nodeeditor::core::view
@@ -0,0 +1,77 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/RenderQuality.hpp"
+
+namespace nodeeditor::core::view
+{
+    RenderQuality&
+    RenderQuality::instance()
+    {
+        static RenderQuality quality;
+        return quality;
+    }
+
+    void
+    RenderQuality::setLevel(Level level, const QString& reason)
+    {
+        m_reason = reason;
+        if (level == m_level)
+            return;
+
+        m_level = level;
+        level_changed.notify(m_level);
+    }
+
+    RenderQuality::Level
+    RenderQuality::level() const
+    {
+        return m_level;
+    }
+
+    const QString&
+    RenderQuality::reason() const
+    {
+        return m_reason;
+    }
+
+    const char*
+    RenderQuality::levelName(Level level)
+    {
+        switch (level)
+        {
+            case Full:
+                return "full";
+            case NoEdgeAntialiasing:
+                return "no edge antialiasing";
+            case NoFlowAnimation:
+                return "no flow animation";
+            case NoPortLabels:
+                return "no port labels";
+            case StraightEdges:
+                return "straight edges";
+        }
+        return "unknown";
+    }
+} // namespace nodeeditor::core::view
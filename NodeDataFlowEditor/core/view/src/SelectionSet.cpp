@@ -0,0 +1,193 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/SelectionSet.hpp"
+
+#include <QtAlgorithms>
+
+namespace nodeeditor::core::view
+{
+    SelectionSet::Index
+    SelectionSet::acquire()
+    {
+        Index index;
+        if (!m_free.empty())
+        {
+            index = m_free.back();
+            m_free.pop_back();
+        }
+        else
+        {
+            index = Index(m_capacity++);
+            const std::size_t words = (m_capacity + WordBits - 1) / WordBits;
+            m_bits.resize(words, 0);
+            m_live.resize(words, 0);
+        }
+        setBit(m_live, index, true);
+        return index;
+    }
+
+    void
+    SelectionSet::release(Index index)
+    {
+        if (!isLive(index))
+            return;
+        if (isSelected(index))
+            --m_count;
+        setBit(m_bits, index, false);
+        setBit(m_live, index, false);
+        m_free.push_back(index);
+    }
+
+    bool
+    SelectionSet::isLive(Index index) const
+    {
+        return index < m_capacity && (m_live[index / WordBits] >> (index % WordBits)) & 1;
+    }
+
+    bool
+    SelectionSet::isSelected(Index index) const
+    {
+        return index < m_capacity && (m_bits[index / WordBits] >> (index % WordBits)) & 1;
+    }
+
+    std::size_t
+    SelectionSet::count() const
+    {
+        return m_count;
+    }
+
+    std::size_t
+    SelectionSet::size() const
+    {
+        return m_capacity - m_free.size();
+    }
+
+    std::size_t
+    SelectionSet::capacity() const
+    {
+        return m_capacity;
+    }
+
+    SelectionSet::Delta
+    SelectionSet::select(Index index, bool selected)
+    {
+        Delta delta;
+        if (!isLive(index) || isSelected(index) == selected)
+            return delta;
+
+        setBit(m_bits, index, selected);
+        if (selected)
+        {
+            ++m_count;
+            delta.selected.push_back(index);
+        }
+        else
+        {
+            --m_count;
+            delta.deselected.push_back(index);
+        }
+        return delta;
+    }
+
+    SelectionSet::Delta
+    SelectionSet::assign(const std::vector<Index>& indices)
+    {
+        std::vector<Word> next(m_bits.size(), 0);
+        for (Index index : indices)
+            if (isLive(index))
+                setBit(next, index, true);
+        return commit(std::move(next));
+    }
+
+    SelectionSet::Delta
+    SelectionSet::add(const std::vector<Index>& indices)
+    {
+        std::vector<Word> next = m_bits;
+        for (Index index : indices)
+            if (isLive(index))
+                setBit(next, index, true);
+        return commit(std::move(next));
+    }
+
+    SelectionSet::Delta
+    SelectionSet::selectAll()
+    {
+        return commit(m_live);
+    }
+
+    SelectionSet::Delta
+    SelectionSet::invert()
+    {
+        std::vector<Word> next(m_bits.size());
+        for (std::size_t w = 0; w < next.size(); ++w)
+            next[w] = ~m_bits[w] & m_live[w];
+        return commit(std::move(next));
+    }
+
+    SelectionSet::Delta
+    SelectionSet::clear()
+    {
+        return commit(std::vector<Word>(m_bits.size(), 0));
+    }
+
+    int
+    SelectionSet::lowestBit(Word word)
+    {
+        return int(qCountTrailingZeroBits(word));
+    }
+
+    SelectionSet::Delta
+    SelectionSet::commit(std::vector<Word> next)
+    {
+        Delta delta;
+        for (std::size_t w = 0; w < next.size(); ++w)
+        {
+            for (Word flipped = m_bits[w] ^ next[w]; flipped; flipped &= flipped - 1)
+            {
+                const int bit = lowestBit(flipped);
+                const Index index = Index(w * WordBits + bit);
+                if ((next[w] >> bit) & 1)
+                    delta.selected.push_back(index);
+                else
+                    delta.deselected.push_back(index);
+            }
+        }
+
+        m_count += delta.selected.size();
+        m_count -= delta.deselected.size();
+        m_bits = std::move(next);
+        return delta;
+    }
+
+    void
+    SelectionSet::setBit(std::vector<Word>& words, Index index, bool on) const
+    {
+        const Word mask = Word(1) << (index % WordBits);
+        if (on)
+            words[index / WordBits] |= mask;
+        else
+            words[index / WordBits] &= ~mask;
+    }
+} // namespace nodeeditor::core::view
@@ -0,0 +1,320 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/SpatialIndex.hpp"
+#include "core/view/ConnectionPathView.hpp"
+#include "core/view/NodeItemView.hpp"
+#include "core/view/PortItemView.hpp"
+
+#include <QLineF>
+#include <QPolygonF>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace nodeeditor::core::view
+{
+    namespace
+    {
+        qreal
+        distanceToSegment(const QPointF& p, const QPointF& a, const QPointF& b)
+        {
+            const QPointF ab = b - a;
+            const qreal lengthSq = QPointF::dotProduct(ab, ab);
+            if (lengthSq <= 0.0)
+                return QLineF(p, a).length();
+            const qreal t = std::clamp(QPointF::dotProduct(p - a, ab) / lengthSq, 0.0, 1.0);
+            return QLineF(p, a + t * ab).length();
+        }
+
+        qreal
+        distanceToRect(const QPointF& p, const QRectF& r)
+        {
+            const qreal dx = std::max({r.left() - p.x(), 0.0, p.x() - r.right()});
+            const qreal dy = std::max({r.top() - p.y(), 0.0, p.y() - r.bottom()});
+            return std::hypot(dx, dy);
+        }
+    } // namespace
+
+    SpatialIndex::SpatialIndex() = default;
+
+    // Edges may already be gone (or pooled, their slots dropped) when the owner dies.
+    SpatialIndex::~SpatialIndex() = default;
+
+    void
+    SpatialIndex::addNode(NodeItemView* node)
+    {
+        if (!node)
+            return;
+        m_nodes.insert(node, node->sceneBoundingRect());
+        refreshNode(node);
+    }
+
+    void
+    SpatialIndex::removeNode(NodeItemView* node)
+    {
+        removePorts(node);
+        m_nodePorts.erase(node);
+        m_nodes.remove(node);
+    }
+
+    void
+    SpatialIndex::refreshNode(NodeItemView* node)
+    {
+        if (!node || !m_nodes.contains(node))
+            return;
+
+        m_nodes.insert(node, node->sceneBoundingRect());
+        removePorts(node);
+
+        for (const auto& port : node->inputs())
+            if (port)
+                addPort(node, PortTable::Side::Input, port->name(), port->sceneBoundingRect(), port->getTagBitMask());
+        for (const auto& port : node->outputs())
+            if (port)
+                addPort(node, PortTable::Side::Output, port->name(), port->sceneBoundingRect(), port->getTagBitMask());
+
+        const PortTable& table = node->portTable();
+        for (const auto side : {PortTable::Side::Input, PortTable::Side::Output})
+        {
+            for (int i = 0; i < table.count(side); ++i)
+            {
+                const auto& row = table.row({side, i});
+                QRectF rect;
+                if (node->rowSceneRect(side, row.name, &rect))
+                    addPort(node, side, row.name, rect, row.tags);
+            }
+        }
+    }
+
+    void
+    SpatialIndex::moveNode(NodeItemView* node, const QPointF& delta)
+    {
+        if (!m_nodes.contains(node))
+            return;
+
+        m_nodes.insert(node, m_nodes.bounds(node).translated(delta));
+
+        auto it = m_nodePorts.find(node);
+        if (it == m_nodePorts.end())
+            return;
+        for (const std::uint64_t id : it->second)
+        {
+            auto& entry = m_portEntries[id];
+            entry.rect.translate(delta);
+            m_ports.insert(id, entry.rect);
+        }
+    }
+
+    void
+    SpatialIndex::addEdge(ConnectionPathView* edge)
+    {
+        if (!edge || m_edgeSlots.count(edge))
+            return;
+        m_edgeSlots[edge] = edge->path_changed.connect([this, edge]() { refreshEdge(edge); });
+        refreshEdge(edge);
+    }
+
+    void
+    SpatialIndex::removeEdge(ConnectionPathView* edge)
+    {
+        auto it = m_edgeSlots.find(edge);
+        if (it == m_edgeSlots.end())
+            return;
+        edge->path_changed.disconnect(it->second);
+        m_edgeSlots.erase(it);
+        m_edges.remove(edge);
+    }
+
+    void
+    SpatialIndex::clear()
+    {
+        for (const auto& [edge, slot] : m_edgeSlots)
+            edge->path_changed.disconnect(slot);
+        m_edgeSlots.clear();
+        m_edges.clear();
+        m_nodes.clear();
+        m_ports.clear();
+        m_portEntries.clear();
+        m_nodePorts.clear();
+    }
+
+    std::vector<NodeItemView*>
+    SpatialIndex::nodesIn(const QRectF& rect) const
+    {
+        std::vector<NodeItemView*> result;
+        m_nodes.query(rect, [&result](NodeItemView* const& node, const QRectF&) { result.push_back(node); });
+        return result;
+    }
+
+    NodeItemView*
+    SpatialIndex::nodeAt(const QPointF& point) const
+    {
+        NodeItemView* top = nullptr;
+        m_nodes.query(QRectF(point, QSizeF()), [&top](NodeItemView* const& node, const QRectF&) {
+            if (!top || node->zValue() > top->zValue())
+                top = node;
+        });
+        return top;
+    }
+
+    std::vector<SpatialIndex::PortHit>
+    SpatialIndex::portsWithin(const QPointF& point, qreal radius) const
+    {
+        std::vector<PortHit> hits;
+        const QRectF probe(point.x() - radius, point.y() - radius, 2 * radius, 2 * radius);
+        m_ports.query(probe, [&](const std::uint64_t& id, const QRectF&) {
+            PortHit hit = makeHit(m_portEntries.at(id), point);
+            if (hit.distance <= radius)
+                hits.push_back(std::move(hit));
+        });
+        std::sort(hits.begin(), hits.end(), [](const PortHit& a, const PortHit& b) { return a.distance < b.distance; });
+        return hits;
+    }
+
+    std::optional<SpatialIndex::PortHit>
+    SpatialIndex::nearestCompatiblePort(const QPointF& point, const PortHit& source, qreal radius) const
+    {
+        const QRectF probe(point.x() - radius, point.y() - radius, 2 * radius, 2 * radius);
+
+        const PortEntry* best = nullptr;
+        qreal bestDistance = radius;
+        m_ports.query(probe, [&](const std::uint64_t& id, const QRectF& rect) {
+            const auto& entry = m_portEntries.at(id);
+            if (entry.node == source.node || entry.side == source.side || !tagsCompatible(entry.tags, source.tags))
+                return;
+            const qreal distance = distanceToRect(point, rect);
+            if (distance <= bestDistance)
+            {
+                best = &entry;
+                bestDistance = distance;
+            }
+        });
+
+        if (!best)
+            return std::nullopt;
+        return makeHit(*best, point);
+    }
+
+    bool
+    SpatialIndex::tagsCompatible(const common::taggable::TagBitMask& a, const common::taggable::TagBitMask& b)
+    {
+        return a.none() || b.none() || (a & b).any();
+    }
+
+    SpatialIndex::PortHit
+    SpatialIndex::makeHit(const PortEntry& entry, const QPointF& point) const
+    {
+        return {entry.node, entry.side, entry.name, entry.rect, entry.rect.center(), distanceToRect(point, entry.rect), entry.tags};
+    }
+
+    std::vector<ConnectionPathView*>
+    SpatialIndex::edgesIn(const QRectF& rect) const
+    {
+        std::vector<ConnectionPathView*> result;
+        m_edges.query(rect, [&result](ConnectionPathView* const& edge, const QRectF&) { result.push_back(edge); });
+        return result;
+    }
+
+    ConnectionPathView*
+    SpatialIndex::nearestEdge(const QPointF& point, qreal maxDistance, qreal* distance) const
+    {
+        const QRectF probe(point.x() - maxDistance, point.y() - maxDistance, 2 * maxDistance, 2 * maxDistance);
+
+        ConnectionPathView* best = nullptr;
+        qreal bestDistance = std::numeric_limits<qreal>::max();
+        m_edges.query(probe, [&](ConnectionPathView* const& edge, const QRectF&) {
+            const qreal d = distanceToEdge(edge, point);
+            if (d <= maxDistance && d < bestDistance)
+            {
+                best = edge;
+                bestDistance = d;
+            }
+        });
+
+        if (distance && best)
+            *distance = bestDistance;
+        return best;
+    }
+
+    std::size_t
+    SpatialIndex::nodeCount() const
+    {
+        return m_nodes.size();
+    }
+
+    std::size_t
+    SpatialIndex::portCount() const
+    {
+        return m_portEntries.size();
+    }
+
+    std::size_t
+    SpatialIndex::edgeCount() const
+    {
+        return m_edges.size();
+    }
+
+    void
+    SpatialIndex::addPort(NodeItemView* node, PortTable::Side side, const QString& name, const QRectF& sceneRect,
+                          const common::taggable::TagBitMask& tags)
+    {
+        const std::uint64_t id = m_nextPortId++;
+        m_portEntries[id] = {node, side, name, sceneRect, tags};
+        m_nodePorts[node].push_back(id);
+        m_ports.insert(id, sceneRect);
+    }
+
+    void
+    SpatialIndex::removePorts(NodeItemView* node)
+    {
+        auto it = m_nodePorts.find(node);
+        if (it == m_nodePorts.end())
+            return;
+        for (const std::uint64_t id : it->second)
+        {
+            m_ports.remove(id);
+            m_portEntries.erase(id);
+        }
+        it->second.clear();
+    }
+
+    void
+    SpatialIndex::refreshEdge(ConnectionPathView* edge)
+    {
+        // Exact curve bounds; pad by the stroke so near misses still land in the cell.
+        m_edges.insert(edge, edge->mapRectToScene(edge->curve().bounds).adjusted(-3, -3, 3, 3));
+    }
+
+    qreal
+    SpatialIndex::distanceToEdge(const ConnectionPathView* edge, const QPointF& point)
+    {
+        const QPointF local = edge->mapFromScene(point);
+        qreal best = std::numeric_limits<qreal>::max();
+        const QPolygonF& polyline = edge->curve().polyline;
+        for (int i = 1; i < polyline.size(); ++i)
+            best = std::min(best, distanceToSegment(local, polyline[i - 1], polyline[i]));
+        return best;
+    }
+} // namespace nodeeditor::core::view
@@ -0,0 +1,112 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "core/view/TextLayoutCache.hpp"
+
+#include <QFontMetricsF>
+#include <QPainter>
+
+namespace nodeeditor::core::view
+{
+    TextLayoutCache&
+    TextLayoutCache::instance()
+    {
+        static TextLayoutCache cache;
+        return cache;
+    }
+
+    TextLayoutCache::Layout
+    TextLayoutCache::layout(const QString& text, const QFont& font)
+    {
+        // QFont::key() identifies family, size, weight and style.
+        const QString key = font.key() + QChar(0x1f) + text;
+
+        auto it = m_layouts.find(key);
+        if (it != m_layouts.end())
+        {
+            ++m_hits;
+            m_lru.splice(m_lru.begin(), m_lru, it->lru);
+            return it->layout;
+        }
+        ++m_misses;
+
+        while (m_layouts.size() >= MaxEntries && !m_lru.empty())
+        {
+            m_layouts.remove(m_lru.back());
+            m_lru.pop_back();
+            ++m_evictions;
+        }
+
+        Layout l;
+        l.text.setText(text);
+        l.text.setTextFormat(Qt::PlainText);
+        l.text.setPerformanceHint(QStaticText::AggressiveCaching);
+        l.text.prepare(QTransform(), font);
+
+        const QFontMetricsF metrics(font);
+        l.size = QSizeF(metrics.horizontalAdvance(text) + 2 * Margin, metrics.height() + 2 * Margin);
+
+        m_lru.push_front(key);
+        m_layouts.insert(key, Entry{l, m_lru.begin()});
+        return l;
+    }
+
+    void
+    TextLayoutCache::draw(QPainter& painter, const QPointF& topLeft, const Layout& layout)
+    {
+        painter.drawStaticText(topLeft + QPointF(Margin, Margin), layout.text);
+    }
+
+    void
+    TextLayoutCache::clear()
+    {
+        m_layouts.clear();
+        m_lru.clear();
+    }
+
+    int
+    TextLayoutCache::size() const
+    {
+        return m_layouts.size();
+    }
+
+    quint64
+    TextLayoutCache::hits() const
+    {
+        return m_hits;
+    }
+
+    quint64
+    TextLayoutCache::misses() const
+    {
+        return m_misses;
+    }
+
+    quint64
+    TextLayoutCache::evictions() const
+    {
+        return m_evictions;
+    }
+
+} // namespace nodeeditor::core::view
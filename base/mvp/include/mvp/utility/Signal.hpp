@@ -19,11 +19,27 @@ namespace base::mvp::utility
          * @brief Connect a slot to the signal.
          * @param slot The callable to connect.
          * @return An ID that can be used to disconnect this slot.
+         *
+         * Disconnected positions are reused, so connect/disconnect cycles do not
+         * grow the list. The ID carries the position's generation: once a slot is
+         * disconnected, its old ID no longer matches and disconnecting with it
+         * again does nothing, even if the position went to a newer slot.
          */
         size_t connect(SlotType slot)
         {
-            m_slots.push_back(std::move(slot));
-            return m_slots.size() - 1;
+            size_t index = m_slots.size();
+            if (!m_free.empty())
+            {
+                index = m_free.back();
+                m_free.pop_back();
+                m_slots[index] = std::move(slot);
+            }
+            else
+            {
+                m_slots.push_back(std::move(slot));
+                m_generations.push_back(0);
+            }
+            return (m_generations[index] << IndexBits) | index;
         }
 
         /**
@@ -32,9 +48,10 @@ namespace base::mvp::utility
          */
         void disconnect(size_t id)
         {
-            if (id < m_slots.size())
+            const size_t index = id & IndexMask;
+            if (index < m_slots.size() && m_generations[index] == (id >> IndexBits) && m_slots[index])
             {
-                m_slots[id] = nullptr;
+                release(index);
             }
         }
 
@@ -43,9 +60,10 @@ namespace base::mvp::utility
          */
         void disconnectAll()
         {
-            for (auto& slot : m_slots)
+            for (size_t i = 0; i < m_slots.size(); ++i)
             {
-                slot = nullptr;
+                if (m_slots[i])
+                    release(i);
             }
         }
 
@@ -71,7 +89,19 @@ namespace base::mvp::utility
         }
 
     private:
+        static constexpr size_t IndexBits = sizeof(size_t) * 4;
+        static constexpr size_t IndexMask = (size_t(1) << IndexBits) - 1;
+
+        void release(size_t index)
+        {
+            m_slots[index] = nullptr;
+            m_generations[index] = (m_generations[index] + 1) & IndexMask;
+            m_free.push_back(index);
+        }
+
         std::vector<SlotType> m_slots;
+        std::vector<size_t> m_generations; ///< Bumped on every disconnect of the position.
+        std::vector<size_t> m_free;        ///< Disconnected positions, reused by connect().
         bool m_blocked = false;
     };
 
@@ -1,8 +1,7 @@
 #include <QApplication>
-#include <QGraphicsScene>
-#include <QGraphicsView>
 
 #include "core/view/GraphScene.hpp"
+#include "core/view/GraphView.hpp"
 
 int
 main(int argc, char* argv[])
@@ -11,11 +10,8 @@ main(int argc, char* argv[])
 
     nodeeditor::core::NodeEditorScene scene;
 
-    QGraphicsView view(&scene);
-    view.setRenderHint(QPainter::Antialiasing);
-    view.setSceneRect(0, 0, 400, 300);
-    view.setBackgroundBrush(Qt::gray);
-    view.setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+    nodeeditor::core::view::GraphView view(&scene);
+    view.resize(800, 600);
     view.show();
     scene.createNode("node", {100, 100});
     scene.addInputPort("node", "p1", "input1");
@@ -25,6 +21,7 @@ main(int argc, char* argv[])
     scene.addOutputPort("node2", "p2", "output1");
 
     scene.createConnection("node", "p1", "node2", "p2");
+    view.centerOn(300, 300);
     
     return app.exec();
 }